@@ -23,8 +23,8 @@
  ****************************************************************************/
 
 #include "AppDelegate.h"
-#include "CardGameSceneMVC.h"
-#include "services/ResourceService.h"
+#include "LoadingScene.h"
+#include "managers/FrameRateGovernor.h"
 
 // #define USE_AUDIO_ENGINE 1
 // #define USE_SIMPLE_AUDIO_ENGINE 1
@@ -98,16 +98,16 @@ bool AppDelegate::applicationDidFinishLaunching() {
     // set FPS. the default value is 1.0/60 if you don't call this
     director->setAnimationInterval(1.0f / 60);
 
+    // 牌桌静止时降低帧率，有触摸或动画时恢复 60 帧
+    FrameRateGovernor::getInstance()->start();
+
     // Set the design resolution 2080, 1080
     glview->setDesignResolutionSize(designResolutionSize.width, designResolutionSize.height, ResolutionPolicy::FIXED_WIDTH);
     director->setContentScaleFactor(1.0f);
     register_all_packages();
 
-    // 预加载卡牌资源
-    ResourceService::preloadCardResources();
-
-    // create a scene. it's an autorelease object
-    auto scene = CardGameSceneMVC::createScene();
+    // 先显示加载场景，卡牌纹理在加载线程上解码，完成后进入游戏场景
+    auto scene = LoadingScene::createScene();
 
     // run
     director->runWithScene(scene);
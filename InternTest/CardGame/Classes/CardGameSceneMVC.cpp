@@ -16,6 +16,7 @@ bool CardGameSceneMVC::init()
     _visibleSize = Director::getInstance()->getVisibleSize();
     _origin = Director::getInstance()->getVisibleOrigin();
     _gameController = nullptr;
+    _background = nullptr;
     
     // 创建UI
     createUI();
@@ -38,11 +39,11 @@ void CardGameSceneMVC::createUI()
 
 void CardGameSceneMVC::createBackground()
 {
-    auto background = LayerColor::create(Color4B(GameConfig::ColorSettings::BACKGROUND_COLOR.r,
-                                                 GameConfig::ColorSettings::BACKGROUND_COLOR.g,
-                                                 GameConfig::ColorSettings::BACKGROUND_COLOR.b,
-                                                 255));
-    this->addChild(background, -1);
+    _background = LayerColor::create(Color4B(GameConfig::ColorSettings::BACKGROUND_COLOR.r,
+                                             GameConfig::ColorSettings::BACKGROUND_COLOR.g,
+                                             GameConfig::ColorSettings::BACKGROUND_COLOR.b,
+                                             255));
+    this->addChild(_background, -1);
 }
 
 // 游戏label部分：如关卡、成绩 
@@ -58,6 +59,23 @@ void CardGameSceneMVC::createMenu()
         CC_CALLBACK_1(CardGameSceneMVC::onRestartClicked, this));
     _restartItem->setPosition(Vec2(_origin.x + _visibleSize.width - 100, _origin.y + _visibleSize.height - 100));
 
+    // 提示按钮
+    _hintItem = MenuItemLabel::create(
+        Label::createWithTTF("Hint", GameConfig::ResourcePaths::FONT_PATH, GameConfig::UISettings::MENU_FONT_SIZE),
+        CC_CALLBACK_1(CardGameSceneMVC::onHintClicked, this));
+    _hintItem->setPosition(Vec2(_origin.x + _visibleSize.width - 100, _origin.y + _visibleSize.height - 150));
+
+    // 撤销/重做按钮
+    _undoItem = MenuItemLabel::create(
+        Label::createWithTTF("Undo", GameConfig::ResourcePaths::FONT_PATH, GameConfig::UISettings::MENU_FONT_SIZE),
+        CC_CALLBACK_1(CardGameSceneMVC::onUndoClicked, this));
+    _undoItem->setPosition(Vec2(_origin.x + _visibleSize.width - 100, _origin.y + _visibleSize.height - 200));
+
+    _redoItem = MenuItemLabel::create(
+        Label::createWithTTF("Redo", GameConfig::ResourcePaths::FONT_PATH, GameConfig::UISettings::MENU_FONT_SIZE),
+        CC_CALLBACK_1(CardGameSceneMVC::onRedoClicked, this));
+    _redoItem->setPosition(Vec2(_origin.x + _visibleSize.width - 100, _origin.y + _visibleSize.height - 250));
+
     // 关闭按钮
     _closeItem = MenuItemImage::create(
         GameConfig::ResourcePaths::CLOSE_NORMAL_IMAGE,
@@ -66,7 +84,7 @@ void CardGameSceneMVC::createMenu()
     _closeItem->setPosition(Vec2(_origin.x + _visibleSize.width - _closeItem->getContentSize().width/2,
                                  _origin.y + _closeItem->getContentSize().height/2));
     
-    _gameMenu = Menu::create(_restartItem, _closeItem, nullptr); // MVP版本：移除_hintItem
+    _gameMenu = Menu::create(_restartItem, _hintItem, _undoItem, _redoItem, _closeItem, nullptr);
     _gameMenu->setPosition(Vec2::ZERO);
     this->addChild(_gameMenu, 10);
 }
@@ -76,16 +94,24 @@ void CardGameSceneMVC::initGameController()
     _gameController = new GameController();
     _gameController->init(this);
 
+    // 背景和静止的卡牌画在离屏纹理中，每帧只绘制正在移动的卡牌
+    if (GameConfig::UISettings::STATIC_LAYER_CACHE_ENABLED && _gameController->setStaticLayerCacheEnabled(true))
+    {
+        _background->setVisible(false);
+    }
+
     setupControllerCallbacks();
 }
 
-// DEMO版本暂未使用，便于测试游戏逻辑
-// 设置游戏结束回调 
+// 设置游戏结束回调：胜利或死局后仍可撤销，也可重新开始
 void CardGameSceneMVC::setupControllerCallbacks()
 {
-    // _gameController->setGameOverCallback([this]() {
-    //     onGameOver();
-    // });
+    _gameController->setGameWinCallback([]() {
+        CCLOG("Game won");
+    });
+    _gameController->setGameOverCallback([]() {
+        CCLOG("Game over: no card left in the stock can match an open main card");
+    });
 }
 
 void CardGameSceneMVC::onRestartClicked(Ref* sender)
@@ -93,6 +119,21 @@ void CardGameSceneMVC::onRestartClicked(Ref* sender)
     _gameController->restartGame();
 }
 
+void CardGameSceneMVC::onHintClicked(Ref* sender)
+{
+    _gameController->requestHint();
+}
+
+void CardGameSceneMVC::onUndoClicked(Ref* sender)
+{
+    _gameController->undoMove();
+}
+
+void CardGameSceneMVC::onRedoClicked(Ref* sender)
+{
+    _gameController->redoMove();
+}
+
 void CardGameSceneMVC::onCloseClicked(Ref* sender)
 {
     Director::getInstance()->end();
@@ -14,6 +14,7 @@ class CardGameSceneMVC : public Scene
 {
 private:
     GameController* _gameController;          // 游戏控制器
+    LayerColor* _background;                  // 背景（启用静态层缓存时由缓存绘制）
     
     // UI元素
     Label* _scoreLabel;                       // 分数标签
@@ -22,8 +23,9 @@ private:
     // 菜单
     Menu* _gameMenu;                          // 游戏菜单
     MenuItemLabel* _restartItem;              // 重新开始按钮
-    // MVP版本：删除Hint功能
-    // MenuItemLabel* _hintItem;              // 已删除
+    MenuItemLabel* _hintItem;                 // 提示按钮
+    MenuItemLabel* _undoItem;                 // 撤销按钮
+    MenuItemLabel* _redoItem;                 // 重做按钮
     MenuItemImage* _closeItem;                // 关闭按钮
     
     Size _visibleSize;                        // 可见区域大小
@@ -41,6 +43,9 @@ public:
     
     // 菜单回调
     void onRestartClicked(Ref* sender);
+    void onHintClicked(Ref* sender);
+    void onUndoClicked(Ref* sender);
+    void onRedoClicked(Ref* sender);
     void onCloseClicked(Ref* sender);
 
 private:
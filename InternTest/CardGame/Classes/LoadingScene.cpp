@@ -0,0 +1,106 @@
+#include "LoadingScene.h"
+#include "CardGameSceneMVC.h"
+#include "configs/GameConfig.h"
+#include "managers/AssetLoader.h"
+#include "managers/CardFaceCache.h"
+#include "services/ResourceService.h"
+
+Scene* LoadingScene::createScene()
+{
+    return LoadingScene::create();
+}
+
+bool LoadingScene::init()
+{
+    if (!Scene::init())
+    {
+        return false;
+    }
+
+    _progressLabel = nullptr;
+    _progressBar = nullptr;
+    _progressBarWidth = 0.0f;
+
+    createProgressUI();
+    return true;
+}
+
+void LoadingScene::onEnter()
+{
+    Scene::onEnter();
+
+    // 关键纹理优先，其余纹理在进入游戏后继续加载
+    std::vector<std::string> critical;
+    std::vector<std::string> deferred;
+    ResourceService::getStartupTexturePaths(critical, deferred);
+
+    AssetLoader* loader = AssetLoader::getInstance();
+    for (const auto& path : critical)
+    {
+        loader->enqueue(path, AssetLoader::CRITICAL);
+    }
+    for (const auto& path : deferred)
+    {
+        loader->enqueue(path, AssetLoader::BACKGROUND);
+    }
+
+    loader->start(
+        [this](int loaded, int total) { updateProgress(loaded, total); },
+        [this]() {
+            // 下一帧再切换场景，确保进度条先显示满格，也避免在加载回调中替换场景
+            this->scheduleOnce([this](float) { enterGame(); }, 0.0f, "enter_game");
+        });
+}
+
+void LoadingScene::createProgressUI()
+{
+    Size visibleSize = Director::getInstance()->getVisibleSize();
+    Vec2 origin = Director::getInstance()->getVisibleOrigin();
+
+    auto background = LayerColor::create(Color4B(GameConfig::ColorSettings::BACKGROUND_COLOR.r,
+                                                 GameConfig::ColorSettings::BACKGROUND_COLOR.g,
+                                                 GameConfig::ColorSettings::BACKGROUND_COLOR.b,
+                                                 255));
+    this->addChild(background, -1);
+
+    // 只用纯色图层和文字，不依赖任何待加载的纹理
+    _progressBarWidth = visibleSize.width * 0.6f;
+    float barHeight = 24.0f;
+    Vec2 barOrigin(origin.x + (visibleSize.width - _progressBarWidth) * 0.5f, origin.y + visibleSize.height * 0.4f);
+
+    auto barBackground = LayerColor::create(Color4B(0, 0, 0, 96), _progressBarWidth, barHeight);
+    barBackground->setPosition(barOrigin);
+    this->addChild(barBackground, 0);
+
+    _progressBar = LayerColor::create(Color4B::WHITE, 0.0f, barHeight);
+    _progressBar->setPosition(barOrigin);
+    this->addChild(_progressBar, 1);
+
+    _progressLabel = Label::createWithTTF("Loading...", GameConfig::ResourcePaths::FONT_PATH,
+                                          GameConfig::UISettings::MENU_FONT_SIZE);
+    if (_progressLabel)
+    {
+        _progressLabel->setPosition(Vec2(origin.x + visibleSize.width * 0.5f, barOrigin.y + barHeight + 60.0f));
+        this->addChild(_progressLabel, 1);
+    }
+}
+
+void LoadingScene::updateProgress(int loaded, int total)
+{
+    float progress = total > 0 ? static_cast<float>(loaded) / total : 1.0f;
+    _progressBar->setContentSize(Size(_progressBarWidth * progress, _progressBar->getContentSize().height));
+    if (_progressLabel)
+    {
+        _progressLabel->setString(StringUtils::format("Loading... %d%%", static_cast<int>(progress * 100.0f)));
+    }
+}
+
+void LoadingScene::enterGame()
+{
+    // 纹理已在 TextureCache 中，这里只注册精灵帧
+    ResourceService::preloadCardResources();
+
+    // 首局用到的牌面在创建视图时按需渲染，其余牌面在之后各帧逐步渲染
+    Director::getInstance()->replaceScene(CardGameSceneMVC::createScene());
+    CardFaceCache::getInstance()->bakeInBackground(GameConfig::LoadingSettings::FACES_BAKED_PER_FRAME);
+}
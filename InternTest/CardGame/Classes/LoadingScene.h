@@ -0,0 +1,39 @@
+#ifndef __LOADING_SCENE_H__
+#define __LOADING_SCENE_H__
+
+#include "cocos2d.h"
+
+USING_NS_CC;
+
+/**
+ * 加载场景
+ * 职责：启动后立即显示，异步加载首局所需纹理并显示进度，完成后切换到游戏场景；
+ *       其余纹理和牌面渲染在进入游戏后于后台继续
+ */
+class LoadingScene : public Scene
+{
+private:
+    Label* _progressLabel;                    // 进度文字
+    LayerColor* _progressBar;                 // 进度条
+    float _progressBarWidth;                  // 进度条满宽
+
+public:
+    static Scene* createScene();
+    virtual bool init();
+    virtual void onEnter();
+
+private:
+    // 创建进度显示
+    void createProgressUI();
+
+    // 更新进度显示
+    void updateProgress(int loaded, int total);
+
+    // 关键纹理就绪：注册精灵帧并进入游戏场景
+    void enterGame();
+
+public:
+    CREATE_FUNC(LoadingScene);
+};
+
+#endif // __LOADING_SCENE_H__
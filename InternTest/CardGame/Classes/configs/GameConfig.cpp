@@ -2,8 +2,23 @@
 
 // 游戏基础配置实现
 const int GameConfig::GameSettings::MAIN_CARDS_COUNT = 9;
+const TableauLayout::Kind GameConfig::GameSettings::MAIN_LAYOUT = TableauLayout::FLAT;  // 三峰/金字塔需将主牌数量改为28
 const int GameConfig::GameSettings::BOTTOM_CARDS_COUNT = 1;
 const int GameConfig::GameSettings::SPARE_CARDS_COUNT = 2;
+const int GameConfig::GameSettings::DEAL_MAX_ATTEMPTS = 100;  // 缺省牌局约一成可解，100次几乎必然成功
+const long long GameConfig::GameSettings::DEAL_MAX_NODES = 200000;  // 只作保险：平铺与有覆盖的牌阵单局都只需数百个节点以内
+
+// 提示配置实现：在工作线程中计算，预算只影响提示出现的快慢，不影响帧率
+const float GameConfig::HintSettings::TIME_BUDGET_MS = 200.0f;
+const long long GameConfig::HintSettings::MAX_NODES = 1000000;
+
+// 加载配置实现
+const int GameConfig::LoadingSettings::MAX_PENDING_REQUESTS = 4;
+const int GameConfig::LoadingSettings::FACES_BAKED_PER_FRAME = 4;
+
+// 帧率配置实现：静止时仍保持低频刷新，工作线程投递的提示结果最多延迟一帧（0.1秒）
+const float GameConfig::FrameRateSettings::IDLE_FRAME_RATE = 10.0f;
+const float GameConfig::FrameRateSettings::IDLE_DELAY = 1.0f;
 
 // 动画配置实现
 const float GameConfig::AnimationSettings::FLIP_ANIMATION_DURATION = 0.6f;  // 增加动画时长，更流畅
@@ -11,6 +26,11 @@ const float GameConfig::AnimationSettings::FLIP_SCALE_FACTOR = 0.0f;
 const bool GameConfig::AnimationSettings::AUTO_FLIP_ENABLED = true;
 const float GameConfig::AnimationSettings::BOUNCE_SCALE_FACTOR = 1.05f;     // 弹跳时的缩放比例
 const float GameConfig::AnimationSettings::BOUNCE_DURATION = 0.1f;          // 弹跳动画时长
+const float GameConfig::AnimationSettings::SHAKE_AMPLITUDE = 5.0f;
+const float GameConfig::AnimationSettings::SHAKE_DURATION = 0.2f;
+const float GameConfig::AnimationSettings::HINT_PULSE_DURATION = 0.15f;
+const int GameConfig::AnimationSettings::HINT_PULSE_REPEATS = 2;
+const int GameConfig::AnimationSettings::TWEEN_POOL_CAPACITY = 32;
 
 // 卡牌配置实现
 const float GameConfig::CardSettings::CARD_WIDTH = 80.0f;
@@ -21,6 +41,8 @@ const float GameConfig::UISettings::MENU_FONT_SIZE = 20.0f;
 const int GameConfig::UISettings::MAIN_CARD_COLS = 5;
 const int GameConfig::UISettings::MAIN_CARD_ROWS = 3;
 const float GameConfig::UISettings::MAIN_CARD_SPACING = 150.0f;
+const bool GameConfig::UISettings::STATIC_LAYER_CACHE_ENABLED = true;
+const int GameConfig::UISettings::PILE_VISIBLE_DEPTH = 2;   // 顶牌移走时下一张已在原位
 
 // 颜色配置实现 初始测试牌背使用的颜色配置
 const Color3B GameConfig::ColorSettings::BACKGROUND_COLOR = Color3B(0, 100, 0);
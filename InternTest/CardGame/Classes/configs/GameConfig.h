@@ -2,6 +2,7 @@
 #define __GAME_CONFIG_H__
 
 #include "cocos2d.h"
+#include "../models/TableauLayout.h"
 
 USING_NS_CC;
 
@@ -15,9 +16,33 @@ public:
     // 游戏基础配置
     struct GameSettings
     {
-        static const int MAIN_CARDS_COUNT;          // 主牌区卡牌数量
+        static const int MAIN_CARDS_COUNT;          // 主牌区卡牌数量（有槽位的牌阵不超过槽位数）
+        static const TableauLayout::Kind MAIN_LAYOUT;   // 主牌区牌阵布局
         static const int BOTTOM_CARDS_COUNT;        // 底牌数量
         static const int SPARE_CARDS_COUNT;         // 备用底牌数量
+        static const int DEAL_MAX_ATTEMPTS;         // 生成可解牌局的最大发牌次数
+        static const long long DEAL_MAX_NODES;      // 单次可解性判定的节点预算，超出视为不可解
+    };
+
+    // 提示配置
+    struct HintSettings
+    {
+        static const float TIME_BUDGET_MS;              // 提示求解的时间预算（毫秒）
+        static const long long MAX_NODES;               // 提示求解的节点预算
+    };
+
+    // 加载配置
+    struct LoadingSettings
+    {
+        static const int MAX_PENDING_REQUESTS;          // 同时提交的异步纹理请求数
+        static const int FACES_BAKED_PER_FRAME;         // 进入游戏后每帧后台渲染的牌面数
+    };
+
+    // 帧率配置
+    struct FrameRateSettings
+    {
+        static const float IDLE_FRAME_RATE;             // 牌桌静止时的帧率
+        static const float IDLE_DELAY;                  // 无触摸、无动画、无加载持续多久后降低帧率（秒）
     };
 
     // 动画系统配置
@@ -28,6 +53,11 @@ public:
         static const bool AUTO_FLIP_ENABLED;           // 是否启用自动翻牌
         static const float BOUNCE_SCALE_FACTOR;        // 弹跳缩放因子
         static const float BOUNCE_DURATION;            // 弹跳动画时长
+        static const float SHAKE_AMPLITUDE;            // 匹配失败摇摆幅度
+        static const float SHAKE_DURATION;             // 匹配失败摇摆时长
+        static const float HINT_PULSE_DURATION;        // 提示高亮单程时长
+        static const int HINT_PULSE_REPEATS;           // 提示高亮次数
+        static const int TWEEN_POOL_CAPACITY;          // 补间记录池的初始容量
     };
     
     // 卡牌配置
@@ -44,6 +74,8 @@ public:
         static const int   MAIN_CARD_COLS;
         static const int   MAIN_CARD_ROWS;
         static const float   MAIN_CARD_SPACING; 
+        static const bool STATIC_LAYER_CACHE_ENABLED;   // 是否把背景和静止卡牌缓存到离屏纹理
+        static const int PILE_VISIBLE_DEPTH;            // 底牌栈/备用栈保留视图的顶部张数
     };
     
     // 颜色配置
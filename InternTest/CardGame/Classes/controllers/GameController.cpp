@@ -2,15 +2,19 @@
 #include "../services/GameLogicService.h"
 #include "../services/CardGeneratorService.h"
 #include "../configs/GameConfig.h"
+#include <algorithm>
 
 GameController::GameController()
-    : _gameModel(nullptr), _cardViewManager(nullptr)
+    : _gameModel(nullptr), _cardViewManager(nullptr), _hintManager(nullptr)
+    , _activeTransitionCard(-1), _drainingTransitions(false), _gameEndPending(false)
 {
     _gameModel = new GameModel();
+    _hintManager = new HintManager(GameConfig::HintSettings::TIME_BUDGET_MS, GameConfig::HintSettings::MAX_NODES);
 }
 
 GameController::~GameController()
 {
+    CC_SAFE_DELETE(_hintManager);  // 先停止后台计算，再释放模型和视图
     CC_SAFE_DELETE(_gameModel);
     CC_SAFE_DELETE(_cardViewManager);
 }
@@ -19,6 +23,14 @@ void GameController::init(Node* parentNode)
 {
     // 创建卡牌视图管理器
     _cardViewManager = new CardViewManager(parentNode);
+
+    // 牌阵布局在整个游戏期间不变，reset 时保留
+    _gameModel->setLayout(TableauLayout::getLayout(GameConfig::GameSettings::MAIN_LAYOUT));
+
+    // 按一局的卡牌总数预建视图，开局和重新开始时只复用，不再创建
+    _cardViewManager->prewarmPool(GameConfig::GameSettings::MAIN_CARDS_COUNT
+                                  + GameConfig::GameSettings::BOTTOM_CARDS_COUNT
+                                  + GameConfig::GameSettings::SPARE_CARDS_COUNT);
     
     // 设置卡牌点击回调
     _cardViewManager->setCardClickCallback([this](int cardId) {
@@ -28,6 +40,9 @@ void GameController::init(Node* parentNode)
 
 void GameController::startNewGame()
 {
+    // 旧局面的提示已失效
+    _hintManager->cancel();
+
     // 重置游戏模型
     _gameModel->reset();
     
@@ -38,6 +53,18 @@ void GameController::startNewGame()
     updateViews();
 }
 
+void GameController::startGameWithSeed(uint64_t dealSeed)
+{
+    _hintManager->cancel();
+    _gameModel->reset();
+
+    // 牌局种子直接决定整副牌，无需再次筛选可解性
+    CardGeneratorService::generateInitialCards(*_gameModel, dealSeed, GameConfig::GameSettings::MAIN_CARDS_COUNT,
+                                               GameConfig::GameSettings::BOTTOM_CARDS_COUNT,
+                                               GameConfig::GameSettings::SPARE_CARDS_COUNT);
+    updateViews();
+}
+
 void GameController::restartGame()
 {
     startNewGame();
@@ -67,15 +94,21 @@ void GameController::onCardClicked(int cardId)
         return;
     }
 
+    // 局面即将变化，取消尚未完成的提示
+    _hintManager->cancel();
+
+    // 按槽位表分类点击的卡牌（常数时间，无拷贝）
+    CardSlotMap::Zone zone = _gameModel->getCardZone(cardId);
+
     // 检查是否点击的是当前底牌
-    if (cardId == _gameModel->getBottomCard().getId())
+    if (zone == CardSlotMap::ZONE_BOTTOM && _gameModel->isStackTop(cardId))
     {
         handleBottomCardClick(cardId);
         return;
     }
 
     // 检查是否点击的是备用底牌
-    if (cardId == _gameModel->getSpareCard().getId())
+    if (zone == CardSlotMap::ZONE_SPARE && _gameModel->isStackTop(cardId))
     {
         handleSpareCardClick(cardId);
         return;
@@ -85,21 +118,102 @@ void GameController::onCardClicked(int cardId)
     handleCardMatch(cardId);
 }
 
+void GameController::undoMove()
+{
+    // 胜利或死局后仍可撤销/重做，暂停时不可
+    if (_gameModel->getGameState() == GameModel::PAUSED)
+    {
+        return;
+    }
+
+    GameMove move;
+    if (!_gameModel->undoMove(&move))
+    {
+        return;
+    }
+    _hintManager->cancel();
+    checkGameEnd();
+    _cardViewManager->applyModelChange(*_gameModel);
+
+    // 播放逆向动画：卡牌回到模型中的原位置
+    queueTransition(move.cardId);
+}
+
+void GameController::redoMove()
+{
+    // 胜利或死局后仍可撤销/重做，暂停时不可
+    if (_gameModel->getGameState() == GameModel::PAUSED)
+    {
+        return;
+    }
+
+    GameMove move;
+    if (!_gameModel->redoMove(&move))
+    {
+        return;
+    }
+    _hintManager->cancel();
+    checkGameEnd();
+    _cardViewManager->applyModelChange(*_gameModel);
+
+    queueTransition(move.cardId);
+}
+
+void GameController::requestHint()
+{
+    if (_gameModel->getGameState() != GameModel::PLAYING)
+    {
+        return;
+    }
+
+    // 工作线程只读取快照，主线程继续渲染和处理输入
+    _hintManager->requestHint(*_gameModel, [this](const HintService::Hint& hint) {
+        handleHintReady(hint);
+    });
+}
+
+void GameController::handleHintReady(const HintService::Hint& hint)
+{
+    if (!hint.hasMove)
+    {
+        CCLOG("Hint: no move available");
+        return;
+    }
+    if (hint.status == SolverService::Result::UNWINNABLE)
+    {
+        CCLOG("Hint: current position cannot be cleared");
+    }
+    _cardViewManager->playHintAnimation(hint.move.cardId);
+}
+
 void GameController::initGameData()
 {
-    // 使用卡牌生成服务初始化卡牌
-    CardGeneratorService::generateInitialCards(*_gameModel, GameConfig::GameSettings::MAIN_CARDS_COUNT,
-                                               GameConfig::GameSettings::BOTTOM_CARDS_COUNT,
-                                               GameConfig::GameSettings::SPARE_CARDS_COUNT);
+    // 使用卡牌生成服务初始化卡牌，不可解的牌局在发给玩家前即被淘汰
+    SolverService::Limits limits;
+    limits.maxNodes = GameConfig::GameSettings::DEAL_MAX_NODES;
+    if (!CardGeneratorService::generateWinnableCards(*_gameModel, GameConfig::GameSettings::MAIN_CARDS_COUNT,
+                                                     GameConfig::GameSettings::BOTTOM_CARDS_COUNT,
+                                                     GameConfig::GameSettings::SPARE_CARDS_COUNT,
+                                                     GameConfig::GameSettings::DEAL_MAX_ATTEMPTS, limits))
+    {
+        CCLOG("Warning: no winnable deal found in %d attempts", GameConfig::GameSettings::DEAL_MAX_ATTEMPTS);
+    }
+    CCLOG("Deal seed: %llu", static_cast<unsigned long long>(_gameModel->getSeed()));
 }
 
 void GameController::updateViews()
 {
+    clearTransitions();
+
     // 更新卡牌视图
     _cardViewManager->updateFromGameModel(*_gameModel);
 
     // 更新卡牌可点击状态
     _cardViewManager->updateCardClickableStates(*_gameModel);
+
+    // 筛选失败时发出的牌局可能开局即是死局（没有过渡，立即通知）
+    checkGameEnd();
+    notifyGameEnd();
 }
 
 void GameController::handleCardMatch(int cardId)
@@ -120,60 +234,11 @@ void GameController::handleCardMatch(int cardId)
 void GameController::handleMatchSuccess(int cardId)
 {
     // 新逻辑：匹配成功的主牌移动到底牌区（类似备用牌点击行为）
-    CardView* matchedCardView = _cardViewManager->getCardView(cardId);
-    if (!matchedCardView)
-    {
-        return;
-    }
-
-    // 预设值
-    matchedCardView->setLocalZOrder(20); 
-
-    // 执行数据操作：将匹配的主牌添加到底牌栈
-    // 获取主牌数据
-    const CardModel* mainCard = _gameModel->getMainCardById(cardId);
-    if (mainCard)
-    {
-        // 创建新的底牌并添加到底牌栈
-        CardModel newBottomCard = *mainCard;
-        newBottomCard.setFaceUp(true); // 底牌应该正面朝上
-        _gameModel->addToBottomStack(newBottomCard);
-
-        // 从主牌栈移除（统一栈式接口）
-        _gameModel->removeFromMainStack(cardId);
-    }
-
-    // 计算目标位置（底牌区）
-    Vec2 targetPosition = _cardViewManager->calculateBottomCardPosition();
-
-    // 创建移动动画
-    float duration = GameConfig::AnimationSettings::FLIP_ANIMATION_DURATION;
-    auto moveAction = MoveTo::create(duration, targetPosition);
-
-    // 翻牌动作（保持正面朝上，因为是底牌）
-    auto flipAction = CallFunc::create([matchedCardView]() {
-        matchedCardView->setFaceUp(true);
-        matchedCardView->updateDisplay();
-        matchedCardView->setLocalZOrder(10); 
-    });
-
-    // 动画完成后的回调
-    auto completeAction = CallFunc::create([this]() {
-        // 同步状态，不重建视图
-        _cardViewManager->syncCardStatesOnly(*_gameModel);
-
-        // 检查游戏是否结束 - DEMO模式：注释掉游戏结束判定
-        // checkGameEnd();
-    });
-
-    // 组合动画序列
-    auto sequence = Sequence::create(
-        Spawn::create(moveAction, flipAction, nullptr),
-        completeAction,
-        nullptr
-    );
-
-    matchedCardView->runAction(sequence);
+    // 执行数据操作：将匹配的主牌移动到底牌栈（记入操作日志），视图过渡排队播放
+    _gameModel->applyMove(GameMove(GameMove::PLAY_MAIN, cardId));
+    checkGameEnd();
+    _cardViewManager->applyModelChange(*_gameModel);
+    queueTransition(cardId);
 }
 
 void GameController::handleMatchFailure(int cardId)
@@ -184,95 +249,132 @@ void GameController::handleMatchFailure(int cardId)
 
 void GameController::handleBottomCardClick(int cardId)
 {
-    // 底牌点击：当前底牌回到备用区，露出下层底牌
-    CardView* bottomCardView = _cardViewManager->getCardView(cardId);
-    if (!bottomCardView)
+    // 底牌点击：当前底牌回到备用区（正面变背面），露出下层底牌
+    _gameModel->applyMove(GameMove(GameMove::BOTTOM_TO_SPARE, cardId));
+    checkGameEnd();
+    _cardViewManager->applyModelChange(*_gameModel);
+    queueTransition(cardId);
+}
+
+void GameController::handleSpareCardClick(int cardId)
+{
+    // 备用牌点击：备用牌移动到底牌区（背面变正面），覆盖当前底牌
+    _gameModel->applyMove(GameMove(GameMove::SPARE_TO_BOTTOM, cardId));
+    checkGameEnd();
+    _cardViewManager->applyModelChange(*_gameModel);
+    queueTransition(cardId);
+}
+
+void GameController::queueTransition(int cardId)
+{
+    // 同一张牌已在队列中时合并：过渡总是以开始播放时的模型状态为终点
+    if (std::find(_pendingTransitions.begin(), _pendingTransitions.end(), cardId) == _pendingTransitions.end())
     {
-        return;
+        _pendingTransitions.push_back(cardId);
     }
 
-    // 预设Z-order，确保卡牌的动画在栈顶显示
-    bottomCardView->setLocalZOrder(20); // 设置高Z-order
+    if (_activeTransitionCard >= 0)
+    {
+        // 队列积压：正在播放的过渡（含翻牌）全部跳到终点后再开始下一个
+        _drainingTransitions = true;
+        _cardViewManager->finishAnimations(_activeTransitionCard);
+        _drainingTransitions = false;
+        _activeTransitionCard = -1;
+    }
+    playNextTransition();
+}
 
-    // 执行数据操作：底牌移动到备用栈
-    _gameModel->moveBottomToSpare();
+void GameController::playNextTransition()
+{
+    // 完成回调可能在循环中同步触发，由最外层的循环继续处理队列
+    if (_drainingTransitions)
+    {
+        return;
+    }
+    _drainingTransitions = true;
+    while (_activeTransitionCard < 0 && !_pendingTransitions.empty())
+    {
+        int cardId = _pendingTransitions.front();
+        _pendingTransitions.pop_front();
+        _activeTransitionCard = cardId;
+        _cardViewManager->playMoveToModelAnimation(cardId, *_gameModel, [this, cardId]() {
+            onTransitionFinished(cardId);
+        });
 
-    // 计算目标位置（备用区栈顶）
-    // 简化：使用固定的栈顶位置，后续可以根据实际栈大小调整
-    Vec2 targetPosition = _cardViewManager->calculateSpareCardPosition();
+        // 后面还有过渡时不播放中间过程，只为最后一个过渡播放动画
+        if (_activeTransitionCard == cardId && !_pendingTransitions.empty())
+        {
+            _cardViewManager->finishAnimations(cardId);
+        }
+    }
+    _drainingTransitions = false;
+}
 
-    // 创建移动动画
-    float duration = GameConfig::AnimationSettings::FLIP_ANIMATION_DURATION;
-    auto moveAction = MoveTo::create(duration, targetPosition);
+void GameController::onTransitionFinished(int cardId)
+{
+    _activeTransitionCard = -1;
 
-    // 翻牌动作（正面变背面）
-    auto flipAction = CallFunc::create([bottomCardView]() {
-        bottomCardView->flipCardWithAnimation([bottomCardView]() {
-                bottomCardView->setLocalZOrder(10); // 动画完成后恢复正常Z-order
-            }
-        );
-    });
+    // 按栈序整理卡牌所在区域，同步状态，不重建视图
+    _cardViewManager->restackZOrder(*_gameModel, _gameModel->getCardZone(cardId));
+    _cardViewManager->syncCardStatesOnly(*_gameModel);
 
-    // 动画完成后的回调
-    auto completeAction = CallFunc::create([this]() {
-       _cardViewManager->syncCardStatesOnly(*_gameModel);
-    });
+    playNextTransition();
 
-    // 组合动画序列
-    auto sequence = Sequence::create(
-        Spawn::create(moveAction, flipAction, nullptr),
-        completeAction,
-        nullptr
-    );
+    // 最后一个过渡播完，视图已与模型一致，再通知胜负
+    if (_activeTransitionCard < 0 && _pendingTransitions.empty())
+    {
+        notifyGameEnd();
+    }
+}
 
-    bottomCardView->runAction(sequence);
+void GameController::clearTransitions()
+{
+    // 视图按模型整体重建，排队和进行中的过渡全部作废
+    _pendingTransitions.clear();
+    _activeTransitionCard = -1;
 }
 
-void GameController::handleSpareCardClick(int cardId)
+void GameController::checkGameEnd()
 {
-    // 备用牌点击：备用牌移动到底牌区，覆盖当前底牌
-    CardView* spareCardView = _cardViewManager->getCardView(cardId);
-    if (!spareCardView)
+    if (_gameModel->getGameState() == GameModel::PAUSED)
     {
         return;
     }
 
-    // 预设Z-order，确保卡牌的动画在栈顶显示
-    spareCardView->setLocalZOrder(20);
-
-    // 执行数据操作：备用牌移动到底牌栈
-    _gameModel->moveSpareToBottom();
-
-    // 计算目标位置（底牌区栈顶）
-    // 简化：直接使用底牌基础位置，避免插入到栈中间的视觉效果
-    Vec2 targetPosition = _cardViewManager->calculateBottomCardPosition();
-
-    // 创建移动动画
-    float duration = GameConfig::AnimationSettings::FLIP_ANIMATION_DURATION;
-    auto moveAction = MoveTo::create(duration, targetPosition);
-
-    // 翻牌动作（背面变正面）
-    auto flipAction = CallFunc::create([spareCardView]() {
-        spareCardView->flipCardWithAnimation([spareCardView]() {
-            spareCardView->setLocalZOrder(10); // 动画完成后恢复正常Z-order
-        });
-    });
-
-    // 动画完成后的回调
-    auto completeAction = CallFunc::create([this]() {
-        // 同步必要的数据状态，避免中断正在进行的翻牌动画
-        _cardViewManager->syncCardStatesOnly(*_gameModel);
-    });
-
-    // 组合动画序列
-    auto sequence = Sequence::create(
-        Spawn::create(moveAction, flipAction, nullptr),
-        completeAction,
-        nullptr
-    );
+    GameModel::GameState state = GameModel::PLAYING;
+    if (_gameModel->isGameWon())
+    {
+        state = GameModel::WIN;
+    }
+    else if (_gameModel->isGameOver())
+    {
+        state = GameModel::LOSE;
+    }
+    if (state == _gameModel->getGameState())
+    {
+        return;
+    }
 
-    spareCardView->runAction(sequence);
+    _gameModel->setGameState(state);
+    _gameEndPending = true;
 }
 
-// DEMO模式：暂无游戏结束判定，让游戏可以无限进行
+void GameController::notifyGameEnd()
+{
+    if (!_gameEndPending)
+    {
+        return;
+    }
+    _gameEndPending = false;
 
+    // 过渡期间又撤销回游戏中时不再通知
+    GameModel::GameState state = _gameModel->getGameState();
+    if (state == GameModel::WIN && _gameWinCallback)
+    {
+        _gameWinCallback();
+    }
+    else if (state == GameModel::LOSE && _gameOverCallback)
+    {
+        _gameOverCallback();
+    }
+}
@@ -4,12 +4,16 @@
 #include "cocos2d.h"
 #include "../models/GameModel.h"
 #include "../managers/CardViewManager.h"
+#include "../managers/HintManager.h"
+#include <deque>
 
 USING_NS_CC;
 
 /**
  * 游戏控制器
  * 职责：协调模型和视图，处理游戏逻辑流程
+ * 输入：点击立即修改模型（点选索引同步更新，下一次点击按新局面判定）；视图过渡按顺序排队播放，
+ *       队列积压时正在播放的过渡直接跳到终点，连续快速点击不必等待动画
  */
 class GameController
 {
@@ -22,6 +26,12 @@ public:
 private:
     GameModel* _gameModel;                      // 游戏数据模型
     CardViewManager* _cardViewManager;          // 卡牌视图管理器
+    HintManager* _hintManager;                  // 提示管理器（后台计算）
+
+    std::deque<int> _pendingTransitions;        // 等待播放视图过渡的卡牌ID
+    int _activeTransitionCard;                  // 正在播放过渡的卡牌ID，没有时为-1
+    bool _drainingTransitions;                  // 是否正在处理过渡队列
+    bool _gameEndPending;                       // 胜负状态已变化，等待过渡播完后通知视图
     
     // 回调函数
     ScoreUpdateCallback _scoreUpdateCallback;
@@ -42,6 +52,7 @@ public:
     
     // 游戏控制
     void startNewGame();
+    void startGameWithSeed(uint64_t dealSeed);  // 按牌局种子复现指定牌局
     void restartGame();
     void pauseGame();
     void resumeGame();
@@ -53,6 +64,16 @@ public:
     // 游戏操作
     void onCardClicked(int cardId);
 
+    // 启用/关闭牌桌静态层缓存，返回当前是否启用
+    bool setStaticLayerCacheEnabled(bool enabled) { return _cardViewManager->setStaticLayerCacheEnabled(enabled); }
+
+    // 请求提示：在后台计算，完成后高亮推荐操作的卡牌
+    void requestHint();
+
+    // 撤销/重做（常数时间，卡牌视图沿原路径返回）
+    void undoMove();
+    void redoMove();
+
 private:
     // 初始化游戏数据
     void initGameData();
@@ -60,6 +81,9 @@ private:
     // 更新视图
     void updateViews();
     
+    // 显示提示结果
+    void handleHintReady(const HintService::Hint& hint);
+
     // 处理卡牌匹配
     void handleCardMatch(int cardId);
     
@@ -74,6 +98,28 @@ private:
 
     // 处理备用底牌点击（切换到当前底牌）
     void handleSpareCardClick(int cardId);
+
+    /**
+     * 排队播放卡牌视图移动到模型当前位置的过渡，同一张牌的多次排队合并为一次
+     * 已有过渡在播放时使其立即完成，只有队列中最后一个过渡播放动画
+     * @param cardId 卡牌ID
+     */
+    void queueTransition(int cardId);
+
+    // 依次开始队列中的过渡
+    void playNextTransition();
+
+    // 过渡结束：按栈序整理卡牌所在区域并继续下一个
+    void onTransitionFinished(int cardId);
+
+    // 清空过渡队列（视图按模型重建时）
+    void clearTransitions();
+
+    // 每次移动后立即按模型判定胜负（常数时间）并更新游戏状态，状态变化时记下待通知；撤销后可回到游戏中
+    void checkGameEnd();
+
+    // 过渡全部播完后按当前状态触发胜利/死局回调
+    void notifyGameEnd();
 };
 
 #endif // __GAME_CONTROLLER_H__
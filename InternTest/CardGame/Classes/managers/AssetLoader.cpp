@@ -0,0 +1,137 @@
+#include "AssetLoader.h"
+#include "../configs/GameConfig.h"
+#include "../services/ResourceService.h"
+
+AssetLoader* AssetLoader::s_instance = nullptr;
+
+AssetLoader* AssetLoader::getInstance()
+{
+    if (!s_instance)
+    {
+        s_instance = new AssetLoader();
+    }
+    return s_instance;
+}
+
+void AssetLoader::destroyInstance()
+{
+    CC_SAFE_DELETE(s_instance);
+}
+
+AssetLoader::AssetLoader()
+    : _criticalTotal(0)
+    , _criticalLoaded(0)
+    , _pendingRequests(0)
+    , _criticalNotified(false)
+{
+}
+
+void AssetLoader::enqueue(const std::string& path, Priority priority)
+{
+    if (priority == CRITICAL)
+    {
+        _criticalQueue.push_back(path);
+        _criticalTotal++;
+    }
+    else
+    {
+        _backgroundQueue.push_back(path);
+    }
+}
+
+void AssetLoader::start(const ProgressCallback& onProgress, const std::function<void()>& onCriticalLoaded)
+{
+    _progressCallback = onProgress;
+    _criticalCallback = onCriticalLoaded;
+    _criticalNotified = false;
+
+    if (_criticalTotal == 0)
+    {
+        // 无关键纹理时推迟到下一帧通知，调用方无需区分同步/异步完成
+        Director::getInstance()->getScheduler()->performFunctionInCocosThread([this]() {
+            notifyCriticalLoaded();
+            submitRequests();
+        });
+        return;
+    }
+    submitRequests();
+}
+
+bool AssetLoader::isLoading() const
+{
+    return _pendingRequests > 0 || !_criticalQueue.empty() || !_backgroundQueue.empty();
+}
+
+void AssetLoader::submitRequests()
+{
+    auto textureCache = Director::getInstance()->getTextureCache();
+    while (_pendingRequests < GameConfig::LoadingSettings::MAX_PENDING_REQUESTS)
+    {
+        std::string path;
+        Priority priority = CRITICAL;
+        if (!_criticalQueue.empty())
+        {
+            path = _criticalQueue.front();
+            _criticalQueue.pop_front();
+        }
+        else if (_criticalLoaded == _criticalTotal && !_backgroundQueue.empty())
+        {
+            path = _backgroundQueue.front();
+            _backgroundQueue.pop_front();
+            priority = BACKGROUND;
+        }
+        else
+        {
+            break;
+        }
+
+        _pendingRequests++;
+
+        // 资源包中有预解码数据时直接上传，无需经过加载线程解码
+        Texture2D* packed = ResourceService::loadPackedTexture(path);
+        if (packed)
+        {
+            onTextureLoaded(path, priority, packed);
+            continue;
+        }
+        textureCache->addImageAsync(path, [this, path, priority](Texture2D* texture) {
+            onTextureLoaded(path, priority, texture);
+        });
+    }
+}
+
+void AssetLoader::onTextureLoaded(const std::string& path, Priority priority, Texture2D* texture)
+{
+    _pendingRequests--;
+    if (!texture)
+    {
+        CCLOG("Warning: failed to load texture asynchronously: %s", path.c_str());
+    }
+
+    if (priority == CRITICAL)
+    {
+        _criticalLoaded++;
+        if (_progressCallback)
+        {
+            _progressCallback(_criticalLoaded, _criticalTotal);
+        }
+        if (_criticalLoaded == _criticalTotal)
+        {
+            notifyCriticalLoaded();
+        }
+    }
+    submitRequests();
+}
+
+void AssetLoader::notifyCriticalLoaded()
+{
+    if (_criticalNotified)
+    {
+        return;
+    }
+    _criticalNotified = true;
+    if (_criticalCallback)
+    {
+        _criticalCallback();
+    }
+}
@@ -0,0 +1,76 @@
+#ifndef __ASSET_LOADER_H__
+#define __ASSET_LOADER_H__
+
+#include "cocos2d.h"
+#include <deque>
+#include <functional>
+#include <string>
+
+USING_NS_CC;
+
+/**
+ * 异步资源加载器
+ * 职责：通过 TextureCache::addImageAsync 在加载线程上解码纹理（预解码资源包中有的纹理直接上传），按优先级提交请求：
+ *       先加载首局显示所需的关键纹理并报告进度，关键纹理全部就绪后再在后台加载其余纹理
+ * 同时提交的请求数受 MAX_PENDING_REQUESTS 限制，使进度回调均匀到达；所有回调都在主线程执行
+ */
+class AssetLoader
+{
+public:
+    // 加载优先级
+    enum Priority
+    {
+        CRITICAL = 0,       // 首局显示所需，计入进度
+        BACKGROUND          // 关键纹理就绪后在后台加载
+    };
+
+    // 进度回调：已完成的关键纹理数、关键纹理总数
+    typedef std::function<void(int loaded, int total)> ProgressCallback;
+
+private:
+    static AssetLoader* s_instance;
+
+    std::deque<std::string> _criticalQueue;     // 待提交的关键纹理
+    std::deque<std::string> _backgroundQueue;   // 待提交的后台纹理
+    int _criticalTotal;                         // 关键纹理总数
+    int _criticalLoaded;                        // 已完成的关键纹理数
+    int _pendingRequests;                       // 已提交、尚未回调的请求数
+    bool _criticalNotified;                     // 是否已通知关键纹理就绪
+    ProgressCallback _progressCallback;
+    std::function<void()> _criticalCallback;
+
+public:
+    static AssetLoader* getInstance();
+    static void destroyInstance();
+
+    /**
+     * 加入加载队列（需在 start 之前调用）
+     * @param path 纹理路径
+     * @param priority 优先级
+     */
+    void enqueue(const std::string& path, Priority priority);
+
+    /**
+     * 开始加载
+     * @param onProgress 每完成一个关键纹理时回调
+     * @param onCriticalLoaded 关键纹理全部完成时回调（无关键纹理时在下一帧回调）
+     */
+    void start(const ProgressCallback& onProgress, const std::function<void()>& onCriticalLoaded);
+
+    // 是否仍有未完成的请求
+    bool isLoading() const;
+
+private:
+    AssetLoader();
+
+    // 在并发上限内提交队列中的请求，关键纹理未全部完成前不提交后台纹理
+    void submitRequests();
+
+    // 单个纹理加载完成（主线程）
+    void onTextureLoaded(const std::string& path, Priority priority, Texture2D* texture);
+
+    // 关键纹理全部完成时通知一次
+    void notifyCriticalLoaded();
+};
+
+#endif // __ASSET_LOADER_H__
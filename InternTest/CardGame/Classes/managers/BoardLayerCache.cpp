@@ -0,0 +1,324 @@
+#include "BoardLayerCache.h"
+#include "TweenManager.h"
+#include <algorithm>
+
+BoardLayerCache::BoardLayerCache(Node* parentNode, const Color3B& backgroundColor)
+    : _parentNode(parentNode)
+    , _renderTexture(nullptr)
+    , _fillLayer(nullptr)
+    , _backgroundColor(backgroundColor)
+    , _dirty(false)
+{
+}
+
+BoardLayerCache::~BoardLayerCache()
+{
+    if (_renderTexture)
+    {
+        _renderTexture->removeFromParent();
+    }
+    CC_SAFE_RELEASE_NULL(_renderTexture);
+    CC_SAFE_RELEASE_NULL(_fillLayer);
+}
+
+bool BoardLayerCache::enable()
+{
+    if (_renderTexture)
+    {
+        return true;
+    }
+
+    Size size = Director::getInstance()->getWinSize();
+    _renderTexture = RenderTexture::create(static_cast<int>(size.width), static_cast<int>(size.height),
+                                           Texture2D::PixelFormat::RGBA8888);
+    if (!_renderTexture)
+    {
+        CCLOG("Warning: failed to create board layer cache");
+        return false;
+    }
+    _renderTexture->retain();
+    _renderTexture->setPosition(Vec2(size.width * 0.5f, size.height * 0.5f));
+    _parentNode->addChild(_renderTexture, CACHE_Z_ORDER);
+
+    _fillLayer = LayerColor::create(Color4B(_backgroundColor.r, _backgroundColor.g, _backgroundColor.b, 255));
+    _fillLayer->retain();
+
+    // 已有视图由调用方逐个 markChanged，下一帧进入缓存
+    _entries.clear();
+    invalidateAll();
+    return true;
+}
+
+void BoardLayerCache::disable()
+{
+    if (!_renderTexture)
+    {
+        return;
+    }
+    for (const auto& pair : _entries)
+    {
+        pair.second.view->setVisible(true);
+    }
+    _entries.clear();
+    _changedViews.clear();
+    _animatingViews.clear();
+    _liveViews.clear();
+    _previousLiveViews.clear();
+    _dirty = false;
+
+    _renderTexture->removeFromParent();
+    CC_SAFE_RELEASE_NULL(_renderTexture);
+    CC_SAFE_RELEASE_NULL(_fillLayer);
+}
+
+void BoardLayerCache::invalidateAll()
+{
+    Size size = Director::getInstance()->getWinSize();
+    markDirty(Rect(0.0f, 0.0f, size.width, size.height));
+}
+
+void BoardLayerCache::markChanged(CardView* view)
+{
+    if (_renderTexture)
+    {
+        _changedViews.push_back(view);
+    }
+}
+
+void BoardLayerCache::removeView(CardView* view)
+{
+    if (!_renderTexture)
+    {
+        return;
+    }
+    auto it = _entries.find(view);
+    if (it != _entries.end())
+    {
+        if (it->second.cached)
+        {
+            markDirty(it->second.bounds);
+        }
+        _entries.erase(it);
+    }
+
+    // 各列表都很短，直接移除
+    _changedViews.erase(std::remove(_changedViews.begin(), _changedViews.end(), view), _changedViews.end());
+    _animatingViews.erase(std::remove(_animatingViews.begin(), _animatingViews.end(), view), _animatingViews.end());
+    _liveViews.erase(std::remove(_liveViews.begin(), _liveViews.end(), view), _liveViews.end());
+    _previousLiveViews.erase(std::remove(_previousLiveViews.begin(), _previousLiveViews.end(), view),
+                             _previousLiveViews.end());
+    view->setVisible(true);
+}
+
+void BoardLayerCache::update()
+{
+    // 没有变化、没有补间、上一帧也没有实时视图时无事可做
+    if (!_renderTexture
+        || (_changedViews.empty() && _animatingViews.empty() && _liveViews.empty() && !_dirty))
+    {
+        return;
+    }
+
+    TweenManager* tweens = TweenManager::getInstance();
+
+    // 变化的视图：擦除旧位置，记录新状态；静止的直接画回缓存，有补间的转为实时绘制
+    for (CardView* view : _changedViews)
+    {
+        Entry& entry = _entries[view];
+        entry.view = view;
+        if (entry.cached)
+        {
+            markDirty(entry.bounds);
+            entry.cached = false;
+        }
+        capture(entry, view);
+
+        bool animating = tweens->isAnimating(view);
+        if (animating && !entry.animating)
+        {
+            _animatingViews.push_back(view);
+        }
+        entry.animating = animating;
+        if (!animating && !entry.live)
+        {
+            markDirty(entry.bounds);
+            entry.cached = true;
+            view->setVisible(false);
+        }
+    }
+    _changedViews.clear();
+
+    // 有补间的视图每帧更新包围盒；补间已结束的移出列表（结束通知已经过上面的处理）
+    for (size_t i = 0; i < _animatingViews.size();)
+    {
+        Entry& entry = _entries[_animatingViews[i]];
+        if (!entry.animating)
+        {
+            _animatingViews[i] = _animatingViews.back();
+            _animatingViews.pop_back();
+            continue;
+        }
+        capture(entry, entry.view);
+        i++;
+    }
+
+    collectLiveViews();
+
+    // 本帧实时绘制的视图从缓存中擦除
+    for (CardView* view : _liveViews)
+    {
+        Entry& entry = _entries[view];
+        if (entry.cached)
+        {
+            markDirty(entry.bounds);
+            entry.cached = false;
+        }
+        if (!view->isVisible())
+        {
+            view->setVisible(true);
+        }
+    }
+
+    // 上一帧实时绘制、本帧不再实时绘制的视图画回缓存
+    for (CardView* view : _previousLiveViews)
+    {
+        auto it = _entries.find(view);
+        if (it != _entries.end() && !it->second.live && !it->second.cached)
+        {
+            capture(it->second, view);
+            markDirty(it->second.bounds);
+            it->second.cached = true;
+            view->setVisible(false);
+        }
+    }
+
+    if (_dirty)
+    {
+        redraw(_dirtyRect);
+        _dirty = false;
+    }
+}
+
+void BoardLayerCache::collectLiveViews()
+{
+    // 上一帧的实时列表留作对比，两个列表交换复用容量
+    for (CardView* view : _liveViews)
+    {
+        auto it = _entries.find(view);
+        if (it != _entries.end())
+        {
+            it->second.live = false;
+        }
+    }
+    _previousLiveViews.swap(_liveViews);
+    _liveViews.clear();
+    if (_animatingViews.empty())
+    {
+        return;
+    }
+
+    Rect liveArea;
+    int lowestLiveZOrder = 0;
+    for (CardView* view : _animatingViews)
+    {
+        Entry& entry = _entries[view];
+        entry.live = true;
+        liveArea = _liveViews.empty() ? entry.bounds : liveArea.unionWithRect(entry.bounds);
+        lowestLiveZOrder = _liveViews.empty() ? entry.zOrder : std::min(lowestLiveZOrder, entry.zOrder);
+        _liveViews.push_back(view);
+    }
+
+    // 与实时视图重叠且层级不低于它的静止视图也实时绘制，否则会被实时视图错误地覆盖；
+    // 先按所有实时视图的并集和最低层级粗筛，过渡中的卡牌位于最上层时没有视图需要逐个比较
+    bool grown = true;
+    while (grown)
+    {
+        grown = false;
+        for (auto& pair : _entries)
+        {
+            Entry& entry = pair.second;
+            if (entry.live || entry.zOrder < lowestLiveZOrder || !entry.bounds.intersectsRect(liveArea))
+            {
+                continue;
+            }
+            for (CardView* view : _liveViews)
+            {
+                const Entry& live = _entries[view];
+                if (entry.zOrder >= live.zOrder && entry.bounds.intersectsRect(live.bounds))
+                {
+                    entry.live = true;
+                    _liveViews.push_back(entry.view);
+                    liveArea = liveArea.unionWithRect(entry.bounds);
+                    grown = true;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void BoardLayerCache::markDirty(const Rect& rect)
+{
+    if (_dirty)
+    {
+        _dirtyRect = _dirtyRect.unionWithRect(rect);
+    }
+    else
+    {
+        _dirtyRect = rect;
+        _dirty = true;
+    }
+}
+
+void BoardLayerCache::capture(Entry& entry, CardView* view)
+{
+    entry.bounds = view->getBoundingBox();
+    entry.zOrder = view->getLocalZOrder();
+}
+
+void BoardLayerCache::redraw(const Rect& area)
+{
+    // 扩展区域，直到与之相交的缓存视图都完全落在区域内，重画整张牌时不会覆盖区域外层级更高的牌
+    Rect region = area;
+    bool grown = true;
+    while (grown)
+    {
+        grown = false;
+        for (const auto& pair : _entries)
+        {
+            const Entry& entry = pair.second;
+            if (entry.cached && entry.bounds.intersectsRect(region)
+                && !(region.containsPoint(entry.bounds.origin)
+                     && region.containsPoint(Vec2(entry.bounds.getMaxX(), entry.bounds.getMaxY()))))
+            {
+                region = region.unionWithRect(entry.bounds);
+                grown = true;
+            }
+        }
+    }
+
+    auto renderer = Director::getInstance()->getRenderer();
+    Mat4 parentTransform = _parentNode->getNodeToWorldTransform();
+
+    _renderTexture->begin();
+
+    _fillLayer->setPosition(region.origin);
+    _fillLayer->setContentSize(region.size);
+    _fillLayer->visit(renderer, parentTransform, Node::FLAGS_TRANSFORM_DIRTY);
+
+    // 按父节点的绘制顺序（Z-order、加入顺序）画出缓存视图；绘制命令已记录变换，画完即可重新隐藏
+    _parentNode->sortAllChildren();
+    for (Node* child : _parentNode->getChildren())
+    {
+        auto it = _entries.find(child);
+        if (it == _entries.end() || !it->second.cached || !it->second.bounds.intersectsRect(region))
+        {
+            continue;
+        }
+        child->setVisible(true);
+        child->visit(renderer, parentTransform, Node::FLAGS_TRANSFORM_DIRTY);
+        child->setVisible(false);
+    }
+
+    _renderTexture->end();
+}
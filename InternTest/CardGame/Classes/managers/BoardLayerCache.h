@@ -0,0 +1,102 @@
+#ifndef __BOARD_LAYER_CACHE_H__
+#define __BOARD_LAYER_CACHE_H__
+
+#include "cocos2d.h"
+#include "../views/CardView.h"
+#include <unordered_map>
+#include <vector>
+
+USING_NS_CC;
+
+/**
+ * 牌桌静态层缓存
+ * 职责：把背景和静止的卡牌渲染到一张全屏离屏纹理中，静止卡牌视图隐藏（不再逐帧遍历和绘制），只有正在变化的卡牌实时绘制
+ * 判定：不逐帧轮询视图，由视图管理器在视图变化时（模型变更集、补间开始/结束、增删视图）调用 markChanged；
+ *       有补间的视图实时绘制，与实时视图重叠且层级不低于它的静止视图也实时绘制，保证遮挡关系不变
+ * 失效：视图在实时/缓存之间切换或静止时发生变化，只重绘其所在矩形（扩展到与之相交的缓存卡牌完全落在区域内），不重绘整张纹理
+ * 开销：没有变化也没有补间的帧立即返回
+ * 约束：父节点的坐标系需与屏幕一致（即场景本身），缓存位于所有卡牌之下
+ */
+class BoardLayerCache
+{
+public:
+    static const int CACHE_Z_ORDER = 0;         // 缓存纹理的Z-order（卡牌最低为2）
+
+private:
+    // 单个卡牌视图的显示状态
+    struct Entry
+    {
+        CardView* view;
+        Rect bounds;                // 父节点坐标系中的包围盒
+        int zOrder;
+        bool animating;             // 是否有进行中的补间
+        bool live;                  // 本帧是否实时绘制
+        bool cached;                // 是否已画在缓存纹理中
+
+        Entry() : view(nullptr), zOrder(0), animating(false), live(false), cached(false) {}
+    };
+
+    Node* _parentNode;                                  // 卡牌视图的父节点
+    RenderTexture* _renderTexture;                      // 静态层（持有引用），未启用时为nullptr
+    LayerColor* _fillLayer;                             // 重绘区域时先铺背景色（持有引用，不在场景中）
+    Color3B _backgroundColor;
+    std::unordered_map<const Node*, Entry> _entries;    // 视图 -> 显示状态
+    std::vector<CardView*> _changedViews;               // 上次 update 以来发生变化的视图（可能重复）
+    std::vector<CardView*> _animatingViews;             // 有补间的视图
+    std::vector<CardView*> _liveViews;                  // 本帧实时绘制的视图（保留容量，每帧 clear）
+    std::vector<CardView*> _previousLiveViews;          // 上一帧实时绘制的视图
+    Rect _dirtyRect;                                    // 待重绘区域
+    bool _dirty;
+
+public:
+    /**
+     * @param parentNode 卡牌视图的父节点
+     * @param backgroundColor 背景色（缓存纹理不透明，启用后场景自身的背景可以隐藏）
+     */
+    BoardLayerCache(Node* parentNode, const Color3B& backgroundColor);
+    ~BoardLayerCache();
+
+    /**
+     * 创建离屏纹理并加入父节点，之后需对已有视图调用 markChanged
+     * @return 是否成功
+     */
+    bool enable();
+
+    // 移除离屏纹理并恢复所有卡牌视图的显示
+    void disable();
+
+    bool isEnabled() const { return _renderTexture != nullptr; }
+
+    /**
+     * 视图加入父节点或显示状态变化（位置、Z-order、牌面、颜色，补间开始或结束），在下一次 update 时处理
+     * @param view 卡牌视图（父节点须为 parentNode）
+     */
+    void markChanged(CardView* view);
+
+    /**
+     * 视图即将移出父节点：从缓存中擦除并恢复显示（对象池复用时可见）
+     * @param view 卡牌视图
+     */
+    void removeView(CardView* view);
+
+    // 每帧调用（在补间推进之后）：处理变化的视图，划分实时/缓存视图并重绘失效区域
+    void update();
+
+    // 使整张缓存失效（例如背景变化）
+    void invalidateAll();
+
+private:
+    // 并入待重绘区域
+    void markDirty(const Rect& rect);
+
+    // 记录视图当前的包围盒和Z-order
+    static void capture(Entry& entry, CardView* view);
+
+    // 本帧实时绘制的视图：有补间的视图，以及与之重叠且层级不低于它的静止视图
+    void collectLiveViews();
+
+    // 重绘区域：先铺背景色，再按绘制顺序画出与区域相交的缓存视图
+    void redraw(const Rect& area);
+};
+
+#endif // __BOARD_LAYER_CACHE_H__
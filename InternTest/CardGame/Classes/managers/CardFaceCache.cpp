@@ -0,0 +1,271 @@
+#include "CardFaceCache.h"
+#include "../services/ResourceService.h"
+
+CardFaceCache* CardFaceCache::s_instance = nullptr;
+
+namespace
+{
+    // 由精灵帧创建精灵，资源缺失时返回nullptr
+    Sprite* createSprite(SpriteFrame* frame)
+    {
+        return frame ? Sprite::createWithSpriteFrame(frame) : nullptr;
+    }
+}
+
+CardFaceCache* CardFaceCache::getInstance()
+{
+    if (!s_instance)
+    {
+        s_instance = new CardFaceCache();
+    }
+    return s_instance;
+}
+
+void CardFaceCache::destroyInstance()
+{
+    CC_SAFE_DELETE(s_instance);
+}
+
+CardFaceCache::CardFaceCache()
+    : _renderTexture(nullptr)
+{
+    for (int i = 0; i < SLOT_COUNT; i++)
+    {
+        _frames[i] = nullptr;
+    }
+}
+
+CardFaceCache::~CardFaceCache()
+{
+    purge();
+}
+
+bool CardFaceCache::bakeAll()
+{
+    if (!ensureRenderTexture())
+    {
+        return false;
+    }
+
+    // 所有槽位一次提交、一次渲染
+    Vector<Node*> stamps;
+    for (int slot = 0; slot < SLOT_COUNT; slot++)
+    {
+        if (!_frames[slot])
+        {
+            bakeSlot(slot, stamps);
+        }
+    }
+    flush();
+    return true;
+}
+
+int CardFaceCache::bakeSome(int maxSlots)
+{
+    if (!ensureRenderTexture())
+    {
+        return 0;
+    }
+
+    Vector<Node*> stamps;
+    int remaining = 0;
+    for (int slot = 0; slot < SLOT_COUNT; slot++)
+    {
+        if (_frames[slot])
+        {
+            continue;
+        }
+        if (maxSlots <= 0)
+        {
+            remaining++;
+        }
+        else if (bakeSlot(slot, stamps))
+        {
+            maxSlots--;
+        }
+        // 资源缺失的槽位不计入剩余数，首次使用时会再尝试渲染
+    }
+    if (!stamps.empty())
+    {
+        flush();
+    }
+    return remaining;
+}
+
+bool CardFaceCache::isBaking() const
+{
+    return Director::getInstance()->getScheduler()->isScheduled("card_face_bake", this);
+}
+
+void CardFaceCache::bakeInBackground(int slotsPerFrame)
+{
+    auto scheduler = Director::getInstance()->getScheduler();
+    scheduler->schedule([this, slotsPerFrame](float) {
+        if (bakeSome(slotsPerFrame) == 0)
+        {
+            Director::getInstance()->getScheduler()->unschedule("card_face_bake", this);
+        }
+    }, this, 0.0f, false, "card_face_bake");
+}
+
+SpriteFrame* CardFaceCache::getFrame(const CardModel& cardModel)
+{
+    return cardModel.isFaceUp() ? getFaceFrame(cardModel.getSuit(), cardModel.getValue()) : getBackFrame();
+}
+
+SpriteFrame* CardFaceCache::getFaceFrame(CardModel::Suit suit, CardModel::Value value)
+{
+    int slot = static_cast<int>(suit) * 13 + (static_cast<int>(value) - 1);
+    if (slot < 0 || slot >= FACE_COUNT)
+    {
+        return nullptr;
+    }
+    if (!_frames[slot] && ensureRenderTexture())
+    {
+        Vector<Node*> stamps;
+        bakeSlot(slot, stamps);
+        flush();
+    }
+    return _frames[slot];
+}
+
+SpriteFrame* CardFaceCache::getBackFrame()
+{
+    if (!_frames[BACK_SLOT] && ensureRenderTexture())
+    {
+        Vector<Node*> stamps;
+        bakeSlot(BACK_SLOT, stamps);
+        flush();
+    }
+    return _frames[BACK_SLOT];
+}
+
+Texture2D* CardFaceCache::getTexture() const
+{
+    return _renderTexture ? _renderTexture->getSprite()->getTexture() : nullptr;
+}
+
+void CardFaceCache::purge()
+{
+    for (int i = 0; i < SLOT_COUNT; i++)
+    {
+        CC_SAFE_RELEASE_NULL(_frames[i]);
+    }
+    CC_SAFE_RELEASE_NULL(_renderTexture);
+}
+
+bool CardFaceCache::ensureRenderTexture()
+{
+    if (_renderTexture)
+    {
+        return true;
+    }
+
+    // 牌面尺寸以卡牌背景图为准
+    SpriteFrame* background = ResourceService::getSpriteFrame(ResourceService::RES_CARD_BACKGROUND);
+    if (!background)
+    {
+        CCLOG("Warning: card face cache disabled, background not found");
+        return false;
+    }
+    _cardSize = background->getOriginalSize();
+
+    int rows = (SLOT_COUNT + FACE_COLUMNS - 1) / FACE_COLUMNS;
+    int width = static_cast<int>(FACE_COLUMNS * (_cardSize.width + SLOT_PADDING));
+    int height = static_cast<int>(rows * (_cardSize.height + SLOT_PADDING));
+    _renderTexture = RenderTexture::create(width, height, Texture2D::PixelFormat::RGBA8888);
+    if (!_renderTexture)
+    {
+        CCLOG("Warning: card face cache disabled, cannot create %dx%d render texture", width, height);
+        return false;
+    }
+    _renderTexture->retain();
+
+    // 清空为透明
+    _renderTexture->beginWithClear(0, 0, 0, 0);
+    _renderTexture->end();
+    return true;
+}
+
+bool CardFaceCache::bakeSlot(int slot, Vector<Node*>& stamps)
+{
+    Node* stamp = nullptr;
+    if (slot == BACK_SLOT)
+    {
+        stamp = createSprite(ResourceService::getSpriteFrame(ResourceService::RES_CARD_BACK));
+    }
+    else
+    {
+        stamp = createFaceStamp(static_cast<CardModel::Suit>(slot / 13), static_cast<CardModel::Value>(slot % 13 + 1));
+    }
+    if (!stamp)
+    {
+        return false;
+    }
+
+    // 离屏纹理的行序与图片相反，上下翻转绘制后可用普通精灵帧直接显示
+    Rect rect = getSlotRect(slot);
+    stamp->setAnchorPoint(Vec2(0.5f, 0.5f));
+    stamp->setPosition(rect.getMidX(), rect.getMidY());
+    stamp->setScaleY(-1.0f);
+
+    _renderTexture->begin();
+    stamp->visit();
+    _renderTexture->end();
+    stamps.pushBack(stamp);  // 渲染命令执行前保持节点存活
+
+    SpriteFrame* frame = SpriteFrame::createWithTexture(_renderTexture->getSprite()->getTexture(), rect);
+    frame->retain();
+    _frames[slot] = frame;
+    return true;
+}
+
+void CardFaceCache::flush()
+{
+    Director::getInstance()->getRenderer()->render();
+}
+
+Node* CardFaceCache::createFaceStamp(CardModel::Suit suit, CardModel::Value value)
+{
+    ResourceService::CardFrames frames = ResourceService::getCardFrames(CardModel(suit, value));
+
+    Sprite* background = createSprite(frames.background);
+    if (!background)
+    {
+        return nullptr;
+    }
+    Size cardSize = background->getContentSize();
+
+    // 中央大数值
+    Sprite* valueSprite = createSprite(frames.value);
+    if (valueSprite)
+    {
+        valueSprite->setPosition(cardSize.width * 0.5f, cardSize.height * 0.5f);
+        background->addChild(valueSprite, 2);
+    }
+
+    // 左上角小数值
+    Sprite* smallValueSprite = createSprite(frames.smallValue);
+    if (smallValueSprite)
+    {
+        smallValueSprite->setPosition(cardSize.width * 0.15f, cardSize.height * 0.85f);
+        background->addChild(smallValueSprite, 2);
+    }
+
+    // 右上角小花色
+    Sprite* smallSuitSprite = createSprite(frames.suit);
+    if (smallSuitSprite)
+    {
+        smallSuitSprite->setPosition(cardSize.width * 0.85f, cardSize.height * 0.85f);
+        background->addChild(smallSuitSprite, 2);
+    }
+    return background;
+}
+
+Rect CardFaceCache::getSlotRect(int slot) const
+{
+    float column = static_cast<float>(slot % FACE_COLUMNS);
+    float row = static_cast<float>(slot / FACE_COLUMNS);
+    return Rect(column * (_cardSize.width + SLOT_PADDING), row * (_cardSize.height + SLOT_PADDING),
+                _cardSize.width, _cardSize.height);
+}
@@ -0,0 +1,101 @@
+#ifndef __CARD_FACE_CACHE_H__
+#define __CARD_FACE_CACHE_H__
+
+#include "cocos2d.h"
+#include "../models/CardModel.h"
+
+USING_NS_CC;
+
+/**
+ * 卡牌牌面缓存
+ * 职责：把52张牌面（背景+大数值+角标数值+角标花色）和牌背各渲染一次到同一张离屏纹理，
+ *       CardView 只需一个精灵切换精灵帧，不再为每张牌挂载子精灵
+ * 布局：纹理按 FACE_COLUMNS 列排布槽位，槽位 suit*13+(value-1) 为牌面，BACK_SLOT 为牌背
+ */
+class CardFaceCache
+{
+public:
+    static const int FACE_COUNT = 52;               // 牌面数量
+    static const int BACK_SLOT = FACE_COUNT;        // 牌背槽位
+    static const int SLOT_COUNT = FACE_COUNT + 1;
+    static const int FACE_COLUMNS = 11;             // 纹理中每行的槽位数
+    static const int SLOT_PADDING = 2;              // 槽位间隔（像素），避免过滤时相邻牌面渗色
+
+private:
+    static CardFaceCache* s_instance;
+
+    RenderTexture* _renderTexture;                  // 离屏纹理
+    SpriteFrame* _frames[SLOT_COUNT];               // 已渲染槽位的精灵帧，未渲染为nullptr
+    Size _cardSize;                                 // 单张牌面尺寸
+
+public:
+    static CardFaceCache* getInstance();
+    static void destroyInstance();
+
+    /**
+     * 渲染全部牌面和牌背（启动时调用，避免游戏中首次翻到某张牌时再渲染）
+     * @return 是否成功
+     */
+    bool bakeAll();
+
+    /**
+     * 渲染至多 maxSlots 个尚未渲染的槽位
+     * @param maxSlots 本次最多渲染的槽位数
+     * @return 剩余未渲染的槽位数，离屏纹理不可用时返回0
+     */
+    int bakeSome(int maxSlots);
+
+    /**
+     * 在后续各帧中逐步渲染剩余槽位，避免一次性渲染造成启动卡顿
+     * @param slotsPerFrame 每帧渲染的槽位数
+     */
+    void bakeInBackground(int slotsPerFrame);
+
+    /**
+     * 获取卡牌当前朝向的精灵帧，尚未渲染的牌面会立即渲染
+     * @param cardModel 卡牌模型
+     * @return 精灵帧，离屏纹理不可用时返回nullptr
+     */
+    SpriteFrame* getFrame(const CardModel& cardModel);
+
+    /**
+     * 获取牌面精灵帧
+     * @param suit 花色
+     * @param value 数值
+     * @return 精灵帧，离屏纹理不可用时返回nullptr
+     */
+    SpriteFrame* getFaceFrame(CardModel::Suit suit, CardModel::Value value);
+
+    // 获取牌背精灵帧
+    SpriteFrame* getBackFrame();
+
+    // 是否仍在后台逐帧渲染剩余槽位
+    bool isBaking() const;
+
+    // 离屏纹理（内容为预乘透明度），尚未创建时返回nullptr
+    Texture2D* getTexture() const;
+
+    // 释放离屏纹理（例如收到内存警告时），之后再次使用会重新渲染
+    void purge();
+
+private:
+    CardFaceCache();
+    ~CardFaceCache();
+
+    // 创建离屏纹理
+    bool ensureRenderTexture();
+
+    // 将一个槽位的内容提交到离屏纹理（需随后调用 flush 执行渲染）
+    bool bakeSlot(int slot, Vector<Node*>& stamps);
+
+    // 立即执行已提交的渲染命令
+    void flush();
+
+    // 构建牌面节点树（与原 CardView 子精灵布局一致）
+    Node* createFaceStamp(CardModel::Suit suit, CardModel::Value value);
+
+    // 槽位在纹理中的矩形（左上角为原点，与精灵帧坐标一致）
+    Rect getSlotRect(int slot) const;
+};
+
+#endif // __CARD_FACE_CACHE_H__
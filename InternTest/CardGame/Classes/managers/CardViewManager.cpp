@@ -1,23 +1,106 @@
 #include "CardViewManager.h"
 #include "../configs/GameConfig.h"
+#include "TweenManager.h"
+#include <algorithm>
 
 CardViewManager::CardViewManager(Node* parentNode)
     : _parentNode(parentNode)
+    , _touchListener(nullptr)
+    , _hitGrid(GameConfig::UISettings::MAIN_CARD_SPACING)  // 格子与主牌间距相当，每张牌只覆盖少数几个格子
+    , _layerCache(nullptr)
+    , _layout(&TableauLayout::getLayout(TableauLayout::FLAT))
+    , _transitionZOrder(0)
 {
     auto director = Director::getInstance();
     _visibleSize = director->getVisibleSize();
     _origin = director->getVisibleOrigin();
+
+    // 全部卡牌共用一个触摸监听，按父节点的场景图优先级分发（菜单等上层节点优先）
+    _touchListener = EventListenerTouchOneByOne::create();
+    _touchListener->setSwallowTouches(true);
+    _touchListener->onTouchBegan = CC_CALLBACK_2(CardViewManager::onTouchBegan, this);
+    _touchListener->retain();
+    _parentNode->getEventDispatcher()->addEventListenerWithSceneGraphPriority(_touchListener, _parentNode);
 }
 
 CardViewManager::~CardViewManager()
 {
+    if (_touchListener)
+    {
+        Director::getInstance()->getEventDispatcher()->removeEventListener(_touchListener);
+        _touchListener->release();
+        _touchListener = nullptr;
+    }
+
+    setStaticLayerCacheEnabled(false);
+    CC_SAFE_DELETE(_layerCache);
+
     clearAllCardViews();
+
+    // 释放对象池持有的引用
+    for (CardView* cardView : _viewPool)
+    {
+        cardView->release();
+    }
+    _viewPool.clear();
+}
+
+bool CardViewManager::setStaticLayerCacheEnabled(bool enabled)
+{
+    auto scheduler = Director::getInstance()->getScheduler();
+    if (!enabled)
+    {
+        if (_layerCache && _layerCache->isEnabled())
+        {
+            scheduler->unschedule("board_layer_cache", this);
+            TweenManager::getInstance()->setActivityCallback(nullptr);
+            _layerCache->disable();
+        }
+        return false;
+    }
+
+    if (!_layerCache)
+    {
+        _layerCache = new BoardLayerCache(_parentNode, GameConfig::ColorSettings::BACKGROUND_COLOR);
+    }
+    if (_layerCache->isEnabled())
+    {
+        return true;
+    }
+    if (!_layerCache->enable())
+    {
+        return false;
+    }
+
+    // 已有视图全部登记一次，之后只在变化时登记
+    for (const auto& pair : _cardViews)
+    {
+        _layerCache->markChanged(pair.second);
+    }
+
+    // 补间开始/结束时登记目标视图（只登记本管理器的卡牌视图）
+    TweenManager::getInstance()->setActivityCallback([this](Node* target) {
+        CardView* cardView = dynamic_cast<CardView*>(target);
+        if (cardView && cardView->getParent() == _parentNode)
+        {
+            _layerCache->markChanged(cardView);
+        }
+    });
+
+    // 自定义定时器在所有 scheduleUpdate 之后执行，此时本帧的补间已推进完毕
+    scheduler->schedule([this](float) {
+        _layerCache->update();
+    }, this, 0.0f, false, "board_layer_cache");
+    return true;
 }
 
 void CardViewManager::updateFromGameModel(const GameModel& gameModel)
 {
-    // 清除现有视图
-    clearAllCardViews();
+    _layout = &gameModel.getLayout();
+    updateTransitionZOrder(gameModel);
+
+    // 回收已不在模型中的视图
+    releaseStaleCardViews(gameModel);
 
     // 创建底牌栈视图
     createBottomCardStackView(gameModel.getBottomCardStack());
@@ -28,44 +111,132 @@ void CardViewManager::updateFromGameModel(const GameModel& gameModel)
     // 创建主牌栈视图
     createMainCardStackView(gameModel.getMainCardStack());
 
-    // 布局卡牌
-    layoutCards(gameModel);
+    updateHitTargets(gameModel);
 }
 
 // 底牌栈视图
 void CardViewManager::createBottomCardStackView(const std::vector<CardModel>& bottomStack)
 {
-    for (size_t i = 0; i < bottomStack.size(); i++)
+    // 只为顶部几张牌保留视图，被完全遮住的牌不创建视图
+    size_t firstVisible = getFirstVisiblePileIndex(bottomStack.size());
+    releaseBuriedPileViews(bottomStack, firstVisible);
+
+    Vec2 bottomPosition = calculateBottomCardPosition();
+    for (size_t i = firstVisible; i < bottomStack.size(); i++)
     {
-        const auto& cardModel = bottomStack[i];
-        CardView* cardView = createCardView(cardModel);
+        // Z-order: 底层卡牌Z值较低，顶层卡牌Z值较高
+        int zOrder = 5 + static_cast<int>(i);
+        reconcileCardView(bottomStack[i], zOrder, bottomPosition);
+    }
+}
+
+// 备用栈视图
+void CardViewManager::createSpareCardStackView(const std::vector<CardModel>& spareStack)
+{
+    size_t firstVisible = getFirstVisiblePileIndex(spareStack.size());
+    releaseBuriedPileViews(spareStack, firstVisible);
+
+    Vec2 sparePosition = calculateSpareCardPosition();
+    for (size_t i = firstVisible; i < spareStack.size(); i++)
+    {
+        // 备用栈的卡牌都是背面朝下
+        CardModel cardModel = spareStack[i];
+        cardModel.setFaceUp(false);
+
+        // Z-order: 备用栈的Z值较低
+        int zOrder = 2 + static_cast<int>(i);
+        reconcileCardView(cardModel, zOrder, sparePosition);
+    }
+}
+
+void CardViewManager::syncPileViews(const GameModel& gameModel)
+{
+    syncPileViews(gameModel.getBottomCardStack(), calculateBottomCardPosition(), 5, false);
+    syncPileViews(gameModel.getSpareCardStack(), calculateSpareCardPosition(), 2, true);
+}
+
+void CardViewManager::syncPileViews(const std::vector<CardModel>& stack, const Vec2& position, int baseZOrder, bool faceDown)
+{
+    size_t firstVisible = getFirstVisiblePileIndex(stack.size());
+    releaseBuriedPileViews(stack, firstVisible);
+
+    // 露出到顶部的牌补建视图；已有视图（包括正在移入的牌）保持不动，由过渡动画负责
+    for (size_t i = firstVisible; i < stack.size(); i++)
+    {
+        if (getCardView(stack[i].getId()))
+        {
+            continue;
+        }
+        CardModel cardModel = stack[i];
+        if (faceDown)
+        {
+            cardModel.setFaceUp(false);
+        }
+        CardView* cardView = acquireCardView(cardModel, baseZOrder + static_cast<int>(i));
         if (cardView)
         {
+            cardView->setPosition(position);
             _cardViews[cardModel.getId()] = cardView;
-            // Z-order: 底层卡牌Z值较低，顶层卡牌Z值较高
-            int zOrder = 5 + static_cast<int>(i);
-            _parentNode->addChild(cardView, zOrder);
+            addHitTarget(cardModel.getId(), position, baseZOrder + static_cast<int>(i));
         }
     }
 }
 
-// 备用栈视图
-void CardViewManager::createSpareCardStackView(const std::vector<CardModel>& spareStack)
+size_t CardViewManager::getFirstVisiblePileIndex(size_t stackSize) const
 {
-    for (size_t i = 0; i < spareStack.size(); i++)
+    size_t depth = static_cast<size_t>(GameConfig::UISettings::PILE_VISIBLE_DEPTH);
+    return stackSize > depth ? stackSize - depth : 0;
+}
+
+void CardViewManager::releaseBuriedPileViews(const std::vector<CardModel>& stack, size_t firstVisible)
+{
+    for (size_t i = 0; i < firstVisible; i++)
+    {
+        auto it = _cardViews.find(stack[i].getId());
+        // 仍在动画中的视图（刚被压到下面）留到下一次同步再回收
+        if (it != _cardViews.end() && !TweenManager::getInstance()->isAnimating(it->second))
+        {
+            releaseCardView(it->second);
+            _cardViews.erase(it);
+            _hitGrid.remove(stack[i].getId());
+        }
+    }
+}
+
+void CardViewManager::applyModelChange(const GameModel& gameModel)
+{
+    syncPileViews(gameModel);
+
+    // 只同步本次操作影响的卡牌，开销与牌桌大小无关；静态层缓存也只重绘这些卡牌
+    for (int cardId : gameModel.getLastChangeSet())
     {
-        const auto& cardModel = spareStack[i];
-        CardView* cardView = createCardView(cardModel);
+        updateHitTarget(gameModel, cardId);
+        CardView* cardView = getCardView(cardId);
         if (cardView)
         {
-            // 备用栈的卡牌都是背面朝下
-            cardView->setFaceUp(false);
+            cardView->setInteractable(gameModel.isCardClickable(cardView->getCardModel()));
+            invalidateCachedView(cardView);
+        }
+    }
+}
 
-            _cardViews[cardModel.getId()] = cardView;
-            // Z-order: 备用栈的Z值较低
-            int zOrder = 2 + static_cast<int>(i);
-            _parentNode->addChild(cardView, zOrder);
+void CardViewManager::updateHitTarget(const GameModel& gameModel, int cardId)
+{
+    _hitGrid.remove(cardId);
+
+    // Z值与 updateHitTargets 一致
+    int index = gameModel.getCardIndex(cardId);
+    switch (gameModel.getCardZone(cardId))
+    {
+        case CardSlotMap::ZONE_MAIN:
+        {
+            int gridIndex = gameModel.findCard(cardId)->getGridIndex();
+            addHitTarget(cardId, calculateMainCardStackPosition(gridIndex), 10 + gridIndex);
+            break;
         }
+        case CardSlotMap::ZONE_BOTTOM: addHitTarget(cardId, calculateBottomCardPosition(), 5 + index); break;
+        case CardSlotMap::ZONE_SPARE: addHitTarget(cardId, calculateSpareCardPosition(), 2 + index); break;
+        default: break;
     }
 }
 
@@ -75,15 +246,10 @@ void CardViewManager::createMainCardStackView(const std::vector<CardModel>& main
     for (size_t i = 0; i < mainStack.size(); i++)
     {
         const auto& cardModel = mainStack[i];
-        CardView* cardView = createCardView(cardModel);
-        if (cardView)
-        {
-            _cardViews[cardModel.getId()] = cardView;
 
-            // 主牌栈使用网格布局，Z-order按索引递增
-            int zOrder = 10 + static_cast<int>(i);
-            _parentNode->addChild(cardView, zOrder);
-        }
+        // 主牌栈使用网格布局，Z-order按网格索引递增
+        int zOrder = 10 + cardModel.getGridIndex();
+        reconcileCardView(cardModel, zOrder, calculateMainCardStackPosition(cardModel.getGridIndex()));
     }
 }
 
@@ -96,26 +262,110 @@ void CardViewManager::createMainCardsView(const std::vector<CardModel>& cardMode
 // 创建单个卡牌视图
 CardView* CardViewManager::createCardView(const CardModel& cardModel)
 {
-    CardView* cardView = CardView::create(cardModel);
-    if (cardView)
+    return CardView::create(cardModel);
+}
+
+CardView* CardViewManager::acquireCardView(const CardModel& cardModel, int zOrder)
+{
+    CardView* cardView = nullptr;
+    if (!_viewPool.empty())
     {
-        // 设置点击回调
-        cardView->setClickCallback([this](int cardId) {
-            onCardClicked(cardId);
-        });
+        // 复用池中视图，只需更换内容
+        cardView = _viewPool.back();
+        _viewPool.pop_back();
+        cardView->setCardModel(cardModel);
+        _parentNode->addChild(cardView, zOrder);
+        cardView->release();  // 场景已持有引用
     }
+    else
+    {
+        cardView = createCardView(cardModel);
+        if (cardView)
+        {
+            _parentNode->addChild(cardView, zOrder);
+        }
+    }
+    invalidateCachedView(cardView);
     return cardView;
 }
 
+void CardViewManager::releaseCardView(CardView* cardView)
+{
+    // 先持有引用再移出场景，避免视图被释放
+    cardView->retain();
+    cardView->resetForReuse();
+    if (_layerCache)
+    {
+        _layerCache->removeView(cardView);
+    }
+    cardView->removeFromParent();
+    _viewPool.push_back(cardView);
+}
+
+void CardViewManager::reconcileCardView(const CardModel& cardModel, int zOrder, const Vec2& position)
+{
+    CardView* cardView = getCardView(cardModel.getId());
+    if (!cardView)
+    {
+        cardView = acquireCardView(cardModel, zOrder);
+        if (!cardView)
+        {
+            return;
+        }
+        _cardViews[cardModel.getId()] = cardView;
+    }
+    else
+    {
+        // 重新开局时同一ID可能对应不同的牌：只有花色、数值或正反面变化时才更换纹理
+        const CardModel& current = cardView->getCardModel();
+        if (TweenManager::getInstance()->isAnimating(cardView))
+        {
+            cardView->resetForReuse();
+        }
+        if (current.getSuit() != cardModel.getSuit() || current.getValue() != cardModel.getValue()
+            || current.isFaceUp() != cardModel.isFaceUp())
+        {
+            cardView->setCardModel(cardModel);
+        }
+        if (cardView->getLocalZOrder() != zOrder)
+        {
+            cardView->setLocalZOrder(zOrder);
+        }
+    }
+
+    if (!cardView->getPosition().equals(position))
+    {
+        cardView->setPosition(position);
+    }
+    invalidateCachedView(cardView);
+}
+
+void CardViewManager::releaseStaleCardViews(const GameModel& gameModel)
+{
+    for (auto it = _cardViews.begin(); it != _cardViews.end();)
+    {
+        if (gameModel.getCardZone(it->first) == CardSlotMap::ZONE_NONE)
+        {
+            releaseCardView(it->second);
+            it = _cardViews.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
 // 移除卡牌视图
 void CardViewManager::removeCardView(int cardId)
 {
     auto it = _cardViews.find(cardId);
     if (it != _cardViews.end())
     {
-        it->second->removeFromParent();
+        releaseCardView(it->second);
         _cardViews.erase(it);
     }
+    _hitGrid.remove(cardId);
 }
 
 // 获取卡牌视图
@@ -129,9 +379,24 @@ void CardViewManager::clearAllCardViews()
 {
     for (auto& pair : _cardViews)
     {
-        pair.second->removeFromParent();
+        releaseCardView(pair.second);
     }
     _cardViews.clear();
+    _hitGrid.clear();
+}
+
+void CardViewManager::prewarmPool(int count)
+{
+    CardModel placeholder;
+    for (int i = static_cast<int>(_viewPool.size()); i < count; i++)
+    {
+        CardView* cardView = createCardView(placeholder);
+        if (cardView)
+        {
+            cardView->retain();
+            _viewPool.push_back(cardView);
+        }
+    }
 }
 
 void CardViewManager::layoutCards(const GameModel& gameModel)
@@ -145,6 +410,7 @@ void CardViewManager::layoutCards(const GameModel& gameModel)
         if (cardView)
         {
             cardView->setPosition(bottomPosition);
+            invalidateCachedView(cardView);
         }
     }
 
@@ -157,17 +423,19 @@ void CardViewManager::layoutCards(const GameModel& gameModel)
         if (cardView)
         {
             cardView->setPosition(sparePosition);
+            invalidateCachedView(cardView);
         }
     }
 
-    // 布局主牌栈（统一接口）
+    // 布局主牌栈（统一接口），主牌栈移除时会交换顺序，位置以网格索引为准
     const auto& mainStack = gameModel.getMainCardStack();
-    for (size_t i = 0; i < mainStack.size(); i++)
+    for (const auto& card : mainStack)
     {
-        CardView* cardView = getCardView(mainStack[i].getId());
+        CardView* cardView = getCardView(card.getId());
         if (cardView)
         {
-            cardView->setPosition(calculateMainCardStackPosition(static_cast<int>(i)));
+            cardView->setPosition(calculateMainCardStackPosition(card.getGridIndex()));
+            invalidateCachedView(cardView);
         }
     }
 }
@@ -192,6 +460,17 @@ Vec2 CardViewManager::calculateMainCardPosition(int index)
 // 主牌栈位置计算
 Vec2 CardViewManager::calculateMainCardStackPosition(int stackIndex)
 {
+    if (stackIndex >= 0 && stackIndex < _layout->getSlotCount())
+    {
+        // 相邻两张牌相距一个主牌间距，即每半张牌半个间距
+        const TableauLayout::Slot& slot = _layout->getSlot(stackIndex);
+        float step = GameConfig::UISettings::MAIN_CARD_SPACING / 2;
+        float centerX = _origin.x + _visibleSize.width/2 + GameConfig::PositionSettings::MAIN_CARDS_OFFSET.x;
+        float centerY = _origin.y + _visibleSize.height/2 + GameConfig::PositionSettings::MAIN_CARDS_OFFSET.y;
+        return Vec2(centerX + (slot.x + 1 - _layout->getWidth() / 2.0f) * step,
+                    centerY - (slot.y + 1 - _layout->getHeight() / 2.0f) * step);
+    }
+
     int row = stackIndex / GameConfig::UISettings::MAIN_CARD_COLS;
     int col = stackIndex % GameConfig::UISettings::MAIN_CARD_COLS;
 
@@ -215,6 +494,98 @@ void CardViewManager::playMismatchAnimation(int cardId)
     }
 }
 
+void CardViewManager::playHintAnimation(int cardId)
+{
+    CardView* cardView = getCardView(cardId);
+    if (cardView)
+    {
+        cardView->playHintAnimation();
+    }
+}
+
+void CardViewManager::playMoveToModelAnimation(int cardId, const GameModel& gameModel, const std::function<void()>& callback)
+{
+    CardView* cardView = getCardView(cardId);
+    const CardModel* card = gameModel.findCard(cardId);
+    if (!cardView || !card)
+    {
+        if (callback)
+        {
+            callback();
+        }
+        return;
+    }
+
+    CardSlotMap::Zone zone = gameModel.getCardZone(cardId);
+    Vec2 targetPosition;
+    switch (zone)
+    {
+        case CardSlotMap::ZONE_BOTTOM: targetPosition = calculateBottomCardPosition(); break;
+        case CardSlotMap::ZONE_SPARE: targetPosition = calculateSpareCardPosition(); break;
+        default: targetPosition = calculateMainCardStackPosition(card->getGridIndex()); break;
+    }
+
+    // 预设Z-order，确保卡牌的动画在最上层显示
+    cardView->setLocalZOrder(_transitionZOrder);
+
+    float duration = GameConfig::AnimationSettings::FLIP_ANIMATION_DURATION;
+    TweenManager::getInstance()->moveTo(cardView, targetPosition, duration, callback);
+
+    // 正反面与模型不一致时翻牌（底牌/备用牌往返），主牌始终正面朝上
+    if (cardView->getCardModel().isFaceUp() != card->isFaceUp())
+    {
+        cardView->flipCardWithAnimation();
+    }
+}
+
+void CardViewManager::updateTransitionZOrder(const GameModel& gameModel)
+{
+    // 静止Z-order：主牌 10+网格索引，底牌栈 5+i，备用栈 2+i；
+    // 网格索引小于槽位数（平铺时小于开局主牌数，不超过卡牌总数），i 小于卡牌总数
+    int totalCount = static_cast<int>(gameModel.getMainCardStack().size() + gameModel.getBottomCardStack().size()
+                                      + gameModel.getSpareCardStack().size());
+    _transitionZOrder = 10 + std::max(_layout->getSlotCount(), totalCount) + 1;
+}
+
+void CardViewManager::finishAnimations(int cardId)
+{
+    CardView* cardView = getCardView(cardId);
+    if (cardView)
+    {
+        TweenManager::getInstance()->finishAll(cardView);
+    }
+}
+
+void CardViewManager::restackZOrder(const GameModel& gameModel, CardSlotMap::Zone zone)
+{
+    // 与创建视图时的Z-order约定一致：备用栈 2+i，底牌栈 5+i，主牌 10+网格索引
+    if (zone == CardSlotMap::ZONE_MAIN)
+    {
+        for (const auto& card : gameModel.getMainCardStack())
+        {
+            CardView* cardView = getCardView(card.getId());
+            if (cardView && cardView->getLocalZOrder() != 10 + card.getGridIndex())
+            {
+                cardView->setLocalZOrder(10 + card.getGridIndex());
+                invalidateCachedView(cardView);
+            }
+        }
+        return;
+    }
+
+    const auto& stack = zone == CardSlotMap::ZONE_BOTTOM ? gameModel.getBottomCardStack() : gameModel.getSpareCardStack();
+    int baseZOrder = zone == CardSlotMap::ZONE_BOTTOM ? 5 : 2;
+    for (size_t i = 0; i < stack.size(); i++)
+    {
+        CardView* cardView = getCardView(stack[i].getId());
+        if (cardView && cardView->getLocalZOrder() != baseZOrder + static_cast<int>(i))
+        {
+            cardView->setLocalZOrder(baseZOrder + static_cast<int>(i));
+            invalidateCachedView(cardView);
+        }
+    }
+}
+
 void CardViewManager::syncBottomCardsState(const GameModel& gameModel)
 {
     // 只更新现有CardView的数据，不重建视图
@@ -225,6 +596,7 @@ void CardViewManager::syncBottomCardsState(const GameModel& gameModel)
     if (bottomCardView)
     {
         bottomCardView->setCardModel(gameModel.getBottomCard());
+        invalidateCachedView(bottomCardView);
     }
 
     // 更新备用底牌CardView的数据模型
@@ -232,13 +604,15 @@ void CardViewManager::syncBottomCardsState(const GameModel& gameModel)
     if (spareCardView)
     {
         spareCardView->setCardModel(gameModel.getSpareCard());
+        invalidateCachedView(spareCardView);
     }
 }
 
 // 只更新卡牌的可点击状态，不触发updateViews
 void CardViewManager::syncCardStatesOnly(const GameModel& gameModel)
 {
-    updateCardClickableStates(gameModel);
+    // 回收过渡期间被压到牌堆下方的视图；可点击状态已在每次操作后按变更集同步
+    syncPileViews(gameModel);
     // 不调用updateFromGameModel()，避免clearAllCardViews()
     // 让正在进行的动画自然完成
 }
@@ -251,12 +625,63 @@ void CardViewManager::onCardClicked(int cardId)
     }
 }
 
+void CardViewManager::updateHitTargets(const GameModel& gameModel)
+{
+    _hitGrid.clear();
+
+    // Z值与视图的栈序约定一致：备用栈 2+i，底牌栈 5+i，主牌 10+网格索引
+    const auto& spareStack = gameModel.getSpareCardStack();
+    for (size_t i = 0; i < spareStack.size(); i++)
+    {
+        addHitTarget(spareStack[i].getId(), calculateSpareCardPosition(), 2 + static_cast<int>(i));
+    }
+    const auto& bottomStack = gameModel.getBottomCardStack();
+    for (size_t i = 0; i < bottomStack.size(); i++)
+    {
+        addHitTarget(bottomStack[i].getId(), calculateBottomCardPosition(), 5 + static_cast<int>(i));
+    }
+    for (const auto& card : gameModel.getMainCardStack())
+    {
+        addHitTarget(card.getId(), calculateMainCardStackPosition(card.getGridIndex()), 10 + card.getGridIndex());
+    }
+}
+
+int CardViewManager::hitTest(const Vec2& location) const
+{
+    return _hitGrid.query(location.x, location.y);
+}
+
+void CardViewManager::addHitTarget(int cardId, const Vec2& position, int zOrder)
+{
+    // 与视图显示区域一致（锚点居中），没有视图的牌不可点
+    auto it = _cardViews.find(cardId);
+    if (it == _cardViews.end())
+    {
+        return;
+    }
+    Size size = it->second->getContentSize();
+    _hitGrid.insert(cardId, position.x - size.width * 0.5f, position.y - size.height * 0.5f,
+                    size.width, size.height, zOrder);
+}
+
+bool CardViewManager::onTouchBegan(Touch* touch, Event* event)
+{
+    int cardId = hitTest(_parentNode->convertToNodeSpace(touch->getLocation()));
+    if (cardId == HitTestGrid::NO_HIT)
+    {
+        return false;
+    }
+    onCardClicked(cardId);
+    return true;
+}
+
 void CardViewManager::setCardClickable(int cardId, bool clickable)
 {
     CardView* cardView = getCardView(cardId);
     if (cardView)
     {
         cardView->setInteractable(clickable);
+        invalidateCachedView(cardView);
     }
 }
 
@@ -270,6 +695,15 @@ void CardViewManager::updateCardClickableStates(const GameModel& gameModel)
             // 检查卡牌是否可点击
             bool clickable = gameModel.isCardClickable(cardView->getCardModel());
             cardView->setInteractable(clickable);
+            invalidateCachedView(cardView);
         }
     }
 }
+
+void CardViewManager::invalidateCachedView(CardView* cardView)
+{
+    if (cardView && _layerCache)
+    {
+        _layerCache->markChanged(cardView);
+    }
+}
@@ -4,6 +4,8 @@
 #include "cocos2d.h"
 #include "../models/GameModel.h"
 #include "../views/CardView.h"
+#include "../utils/HitTestGrid.h"
+#include "BoardLayerCache.h"
 #include <map>
 
 USING_NS_CC;
@@ -11,6 +13,9 @@ USING_NS_CC;
 /**
  * 卡牌视图管理器
  * 职责：管理所有卡牌视图的创建、更新和销毁
+ * 点选：只注册一个触摸监听，触摸点经网格索引解析为最上层卡牌ID，开销与卡牌数量无关
+ * 牌堆：底牌栈和备用栈只为顶部 PILE_VISIBLE_DEPTH 张牌保留视图，被完全遮住的牌没有视图，帧开销与牌堆深度无关
+ * 同步：每次操作后按模型的变更集只更新受影响的卡牌，整体重建只在开局时进行
  */
 class CardViewManager
 {
@@ -21,7 +26,13 @@ public:
 private:
     Node* _parentNode;                          // 父节点
     std::map<int, CardView*> _cardViews;        // 卡牌视图映射表
+    std::vector<CardView*> _viewPool;           // 已回收的卡牌视图（持有引用，不在场景中）
     CardClickCallback _cardClickCallback;       // 卡牌点击回调
+    EventListenerTouchOneByOne* _touchListener; // 统一的触摸监听（持有引用）
+    HitTestGrid _hitGrid;                       // 卡牌静止位置的点选索引（父节点坐标系）
+    BoardLayerCache* _layerCache;               // 静态层缓存，未启用时为nullptr
+    const TableauLayout* _layout;               // 主牌区牌阵布局（取自模型）
+    int _transitionZOrder;                      // 过渡动画期间卡牌的Z-order，开局时算出
     Size _visibleSize;                          // 可见区域大小
     Vec2 _origin;                               // 原点位置
 
@@ -31,8 +42,17 @@ public:
     
     // 设置卡牌点击回调
     void setCardClickCallback(const CardClickCallback& callback) { _cardClickCallback = callback; }
+
+    /**
+     * 启用/关闭静态层缓存：背景和静止的卡牌画在一张离屏纹理中，只有正在变化的卡牌实时绘制
+     * 启用后缓存自带背景色，父节点自身的背景可以隐藏
+     * @param enabled 是否启用
+     * @return 当前是否处于启用状态（离屏纹理创建失败时为false）
+     */
+    bool setStaticLayerCacheEnabled(bool enabled);
     
-    // 根据游戏模型更新所有卡牌视图
+    // 根据游戏模型更新所有卡牌视图：按卡牌ID对比现有视图，
+    // 只重设内容或位置有变化的视图，多余的视图回收到对象池
     void updateFromGameModel(const GameModel& gameModel);
     
     // 创建底牌视图
@@ -46,6 +66,20 @@ public:
     void createSpareCardStackView(const std::vector<CardModel>& spareStack);
     void createMainCardStackView(const std::vector<CardModel>& mainStack);
 
+    /**
+     * 按牌堆当前深度增减视图：露出到顶部的牌补建视图，被压到下方的牌回收视图
+     * 已有视图不做修改，不会打断正在播放的过渡
+     * @param gameModel 游戏模型
+     */
+    void syncPileViews(const GameModel& gameModel);
+
+    /**
+     * 每次 applyMove/undoMove/redoMove 后立即调用：同步牌堆视图，
+     * 并按模型的变更集只更新受影响卡牌的点选区域和可点击状态
+     * @param gameModel 游戏模型
+     */
+    void applyModelChange(const GameModel& gameModel);
+
     // 创建主牌区视图（兼容性接口）
     void createMainCardsView(const std::vector<CardModel>& cardModels);
     
@@ -55,8 +89,11 @@ public:
     // 获取卡牌视图
     CardView* getCardView(int cardId);
     
-    // 清除所有卡牌视图
+    // 清除所有卡牌视图（回收到对象池）
     void clearAllCardViews();
+
+    // 预先创建视图放入对象池，避免首局或卡牌增多时集中创建
+    void prewarmPool(int count);
     
     // 布局卡牌
     void layoutCards(const GameModel& gameModel);
@@ -64,6 +101,24 @@ public:
     // 播放不匹配动画
     void playMismatchAnimation(int cardId);
 
+    // 播放提示高亮动画
+    void playHintAnimation(int cardId);
+
+    /**
+     * 将卡牌视图移动到模型中的当前位置（撤销/重做时沿原路径返回或重放）
+     * 正反面与模型不一致时同时播放翻牌动画；动画期间视图位于最上层，由调用方在回调中调用 restackZOrder 整理
+     * @param cardId 卡牌ID
+     * @param gameModel 已执行撤销/重做的游戏模型
+     * @param callback 动画完成回调（只捕获少量指针/整数时不分配内存）
+     */
+    void playMoveToModelAnimation(int cardId, const GameModel& gameModel, const std::function<void()>& callback = nullptr);
+
+    // 使卡牌视图上进行中的动画立即到达终点（触发完成回调）
+    void finishAnimations(int cardId);
+
+    // 按栈序重设某区域卡牌视图的Z-order
+    void restackZOrder(const GameModel& gameModel, CardSlotMap::Zone zone);
+
     // 安全的底牌状态同步（不重建视图，只更新数据）
     void syncBottomCardsState(const GameModel& gameModel);
 
@@ -79,15 +134,65 @@ public:
     Vec2 calculateSpareCardPosition();
     Vec2 calculateMainCardPosition(int index);
 
-    // 栈式位置计算
+    // 栈式位置计算：有槽位的牌阵按槽位坐标（半张牌为单位）居中排布，否则按网格行列排布
     Vec2 calculateMainCardStackPosition(int stackIndex);
 
     // 卡牌点击处理
     void onCardClicked(int cardId);
 
+    /**
+     * 按模型重建点选索引：每张牌登记其静止位置的矩形和栈序Z值
+     * 模型变化后立即调用（不必等动画结束），移动中的卡牌按目标位置响应点击
+     * @param gameModel 游戏模型
+     */
+    void updateHitTargets(const GameModel& gameModel);
+
+    /**
+     * 把父节点坐标系中的点解析为卡牌ID
+     * @param location 父节点坐标系中的点
+     * @return 卡牌ID，未点中卡牌时返回 HitTestGrid::NO_HIT
+     */
+    int hitTest(const Vec2& location) const;
+
 private:
     // 创建单个卡牌视图
     CardView* createCardView(const CardModel& cardModel);
+
+    // 从对象池取出视图（池为空时新建），并加入场景
+    CardView* acquireCardView(const CardModel& cardModel, int zOrder);
+
+    // 将视图移出场景并放回对象池
+    void releaseCardView(CardView* cardView);
+
+    // 复用或创建卡牌视图，仅在内容、Z-order或位置变化时更新
+    void reconcileCardView(const CardModel& cardModel, int zOrder, const Vec2& position);
+
+    // 回收模型中已不存在的卡牌视图
+    void releaseStaleCardViews(const GameModel& gameModel);
+
+    // 同步单个牌堆的视图
+    void syncPileViews(const std::vector<CardModel>& stack, const Vec2& position, int baseZOrder, bool faceDown);
+
+    // 牌堆中第一张保留视图的牌的下标
+    size_t getFirstVisiblePileIndex(size_t stackSize) const;
+
+    // 回收下标 firstVisible 以下的牌的视图（正在动画中的除外）
+    void releaseBuriedPileViews(const std::vector<CardModel>& stack, size_t firstVisible);
+
+    // 登记一张牌的点选矩形（以静止位置为中心）
+    void addHitTarget(int cardId, const Vec2& position, int zOrder);
+
+    // 按卡牌在模型中的当前位置重新登记点选区域
+    void updateHitTarget(const GameModel& gameModel, int cardId);
+
+    // 按牌阵和卡牌总数算出过渡Z-order：高于本局任何卡牌可能的静止Z-order，本局内不再变化
+    void updateTransitionZOrder(const GameModel& gameModel);
+
+    // 视图显示状态变化后通知静态层缓存（未启用时忽略）
+    void invalidateCachedView(CardView* cardView);
+
+    // 触摸事件处理
+    bool onTouchBegan(Touch* touch, Event* event);
 };
 
 #endif // __CARD_VIEW_MANAGER_H__
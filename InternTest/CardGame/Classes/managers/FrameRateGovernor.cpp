@@ -0,0 +1,127 @@
+#include "FrameRateGovernor.h"
+#include "../configs/GameConfig.h"
+#include "AssetLoader.h"
+#include "CardFaceCache.h"
+#include "TweenManager.h"
+
+FrameRateGovernor* FrameRateGovernor::s_instance = nullptr;
+
+FrameRateGovernor* FrameRateGovernor::getInstance()
+{
+    if (!s_instance)
+    {
+        s_instance = new FrameRateGovernor();
+    }
+    return s_instance;
+}
+
+void FrameRateGovernor::destroyInstance()
+{
+    CC_SAFE_DELETE(s_instance);
+}
+
+FrameRateGovernor::FrameRateGovernor()
+    : _touchListener(nullptr)
+    , _activeTouches(0)
+    , _idleTime(0.0f)
+    , _activeInterval(1.0f / 60)
+    , _idle(false)
+    , _started(false)
+{
+}
+
+FrameRateGovernor::~FrameRateGovernor()
+{
+    if (!_started)
+    {
+        return;
+    }
+    auto director = Director::getInstance();
+    director->getScheduler()->unscheduleUpdate(this);
+    director->getEventDispatcher()->removeEventListener(_touchListener);
+    CC_SAFE_RELEASE_NULL(_touchListener);
+    if (_idle)
+    {
+        director->setAnimationInterval(_activeInterval);
+    }
+}
+
+void FrameRateGovernor::start()
+{
+    if (_started)
+    {
+        return;
+    }
+    _started = true;
+
+    auto director = Director::getInstance();
+    _activeInterval = director->getAnimationInterval();
+
+    // 固定优先级 -1 先于场景中的监听收到触摸；不吞没，卡牌点选等监听照常处理
+    _touchListener = EventListenerTouchOneByOne::create();
+    _touchListener->setSwallowTouches(false);
+    _touchListener->onTouchBegan = [this](Touch*, Event*) {
+        _activeTouches++;
+        wake();
+        return true;
+    };
+    _touchListener->onTouchEnded = [this](Touch*, Event*) {
+        if (_activeTouches > 0)
+        {
+            _activeTouches--;
+        }
+    };
+    _touchListener->onTouchCancelled = _touchListener->onTouchEnded;
+    _touchListener->retain();
+    director->getEventDispatcher()->addEventListenerWithFixedPriority(_touchListener, -1);
+
+    director->getScheduler()->scheduleUpdate(this, 0, false);
+}
+
+void FrameRateGovernor::wake()
+{
+    _idleTime = 0.0f;
+    if (_idle)
+    {
+        setIdle(false);
+    }
+}
+
+void FrameRateGovernor::update(float dt)
+{
+    if (isBusy())
+    {
+        wake();
+        return;
+    }
+
+    _idleTime += dt;
+    if (!_idle && _idleTime >= GameConfig::FrameRateSettings::IDLE_DELAY)
+    {
+        setIdle(true);
+    }
+}
+
+bool FrameRateGovernor::isBusy() const
+{
+    if (_activeTouches > 0 || TweenManager::getInstance()->getActiveCount() > 0)
+    {
+        return true;
+    }
+    if (Director::getInstance()->getActionManager()->getNumberOfRunningActions() > 0)
+    {
+        return true;
+    }
+    return AssetLoader::getInstance()->isLoading() || CardFaceCache::getInstance()->isBaking();
+}
+
+void FrameRateGovernor::setIdle(bool idle)
+{
+    _idle = idle;
+    float interval = _activeInterval;
+    if (idle)
+    {
+        interval = 1.0f / GameConfig::FrameRateSettings::IDLE_FRAME_RATE;
+    }
+    Director::getInstance()->setAnimationInterval(interval);
+}
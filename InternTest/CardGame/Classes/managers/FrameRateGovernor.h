@@ -0,0 +1,53 @@
+#ifndef __FRAME_RATE_GOVERNOR_H__
+#define __FRAME_RATE_GOVERNOR_H__
+
+#include "cocos2d.h"
+
+USING_NS_CC;
+
+/**
+ * 帧率调节器
+ * 职责：牌桌静止时降低 Director 的刷新频率，减少耗电和发热；有输入或动画时恢复正常帧率
+ * 静止：没有按下的触摸、没有进行中的补间和 cocos 动作、没有异步加载和后台牌面渲染，并持续 IDLE_DELAY 秒
+ * 恢复：触摸按下时立即恢复；其他来源（例如主线程回调中开始的动画）在低帧率下的下一次检查时恢复
+ */
+class FrameRateGovernor
+{
+private:
+    static FrameRateGovernor* s_instance;
+
+    EventListenerTouchOneByOne* _touchListener;     // 观察所有触摸（不吞没，持有引用）
+    int _activeTouches;                             // 按下未抬起的触摸数
+    float _idleTime;                                // 已持续静止的时间（秒）
+    float _activeInterval;                          // 正常帧间隔（start 时的帧间隔）
+    bool _idle;                                     // 是否处于低帧率
+    bool _started;
+
+public:
+    static FrameRateGovernor* getInstance();
+    static void destroyInstance();
+
+    // 开始调节：以当前帧间隔为正常帧率，注册触摸观察和每帧检查（在 setAnimationInterval 之后调用）
+    void start();
+
+    // 立即恢复正常帧率并重新计时
+    void wake();
+
+    // 是否处于低帧率
+    bool isIdle() const { return _idle; }
+
+    // 每帧检查（由调度器调用）
+    void update(float dt);
+
+private:
+    FrameRateGovernor();
+    ~FrameRateGovernor();
+
+    // 是否有需要正常帧率的活动
+    bool isBusy() const;
+
+    // 切换帧率
+    void setIdle(bool idle);
+};
+
+#endif // __FRAME_RATE_GOVERNOR_H__
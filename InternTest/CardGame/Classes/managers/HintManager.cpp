@@ -0,0 +1,66 @@
+#include "HintManager.h"
+#include <thread>
+
+HintManager::HintManager(double timeBudgetMs, long long maxNodes)
+    : _timeBudgetMs(timeBudgetMs), _maxNodes(maxNodes)
+{
+}
+
+HintManager::~HintManager()
+{
+    cancel();
+}
+
+void HintManager::setBudget(double timeBudgetMs, long long maxNodes)
+{
+    _timeBudgetMs = timeBudgetMs;
+    _maxNodes = maxNodes;
+}
+
+bool HintManager::requestHint(const GameModel& gameModel, const HintCallback& callback)
+{
+    cancel();
+
+    std::shared_ptr<HintJob> job = std::make_shared<HintJob>();
+    if (!PackedGameState::fromGameModel(gameModel, job->snapshot))
+    {
+        return false;
+    }
+    job->limits.timeBudgetMs = _timeBudgetMs;
+    job->limits.maxNodes = _maxNodes;
+    job->limits.cancelFlag = &job->cancelled;
+    job->callback = callback;
+
+    _currentJob = job;
+
+    // 分离运行：线程持有任务的共享指针，取消后自行在下一次检查标记时退出
+    std::thread(&HintManager::runJob, job).detach();
+    return true;
+}
+
+void HintManager::cancel()
+{
+    if (_currentJob)
+    {
+        _currentJob->cancelled.store(true, std::memory_order_relaxed);
+        _currentJob.reset();
+    }
+}
+
+void HintManager::runJob(std::shared_ptr<HintJob> job)
+{
+    HintService::Hint hint = HintService::computeHint(job->snapshot, job->limits);
+    if (job->cancelled.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    // 投递回主线程；执行前局面可能已变化，因此在主线程再检查一次取消标记
+    Director::getInstance()->getScheduler()->performFunctionInCocosThread([job, hint]() {
+        if (!job->cancelled.load(std::memory_order_relaxed) && job->callback)
+        {
+            job->cancelled.store(true, std::memory_order_relaxed);  // 每个任务只回调一次
+            job->callback(hint);
+        }
+    });
+}
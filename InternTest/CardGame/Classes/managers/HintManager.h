@@ -0,0 +1,66 @@
+#ifndef __HINT_MANAGER_H__
+#define __HINT_MANAGER_H__
+
+#include "cocos2d.h"
+#include "../models/GameModel.h"
+#include "../services/HintService.h"
+#include <atomic>
+#include <memory>
+
+USING_NS_CC;
+
+/**
+ * 提示管理器
+ * 职责：在工作线程中对局面快照计算提示，结果通过cocos调度器投递回主线程；
+ *       局面变化时取消正在进行的计算，过期结果不会回调
+ * 线程：工作线程分离运行，任务由共享指针持有，取消只置标记、不等待线程退出，主线程不会阻塞
+ */
+class HintManager
+{
+public:
+    // 提示完成回调（在主线程调用）
+    typedef std::function<void(const HintService::Hint& hint)> HintCallback;
+
+private:
+    // 一次提示计算任务，由工作线程与投递到主线程的回调共享
+    struct HintJob
+    {
+        PackedGameState snapshot;           // 局面快照，工作线程只读取快照
+        SolverService::Limits limits;
+        std::atomic<bool> cancelled;        // 取消标记，同时作为求解器的取消标记
+        HintCallback callback;
+
+        HintJob() : cancelled(false) {}
+    };
+
+    std::shared_ptr<HintJob> _currentJob;   // 当前任务
+    double _timeBudgetMs;                   // 时间预算（毫秒）
+    long long _maxNodes;                    // 节点预算
+
+public:
+    HintManager(double timeBudgetMs, long long maxNodes);
+    ~HintManager();
+
+    // 设置预算
+    void setBudget(double timeBudgetMs, long long maxNodes);
+
+    /**
+     * 对当前局面开始计算提示，会取消尚未完成的上一次计算
+     * @param gameModel 游戏数据模型（在调用线程中拍快照）
+     * @param callback 提示完成回调
+     * @return 是否成功启动（局面超出紧凑状态容量时返回false）
+     */
+    bool requestHint(const GameModel& gameModel, const HintCallback& callback);
+
+    // 取消正在进行的计算，已投递但未执行的回调也会被丢弃
+    void cancel();
+
+    // 是否有尚未完成的计算
+    bool isPending() const { return _currentJob && !_currentJob->cancelled.load(std::memory_order_relaxed); }
+
+private:
+    // 工作线程入口
+    static void runJob(std::shared_ptr<HintJob> job);
+};
+
+#endif // __HINT_MANAGER_H__
@@ -0,0 +1,431 @@
+#include "TweenManager.h"
+#include "../configs/GameConfig.h"
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    // 已推进比例，时长为0时视为已完成
+    float progress(float elapsed, float length)
+    {
+        if (length <= 0.0f || elapsed >= length)
+        {
+            return 1.0f;
+        }
+        return elapsed > 0.0f ? elapsed / length : 0.0f;
+    }
+
+    // 与 EaseInOut（rate 2）一致的缓入缓出
+    float easeInOut(float t)
+    {
+        t *= 2.0f;
+        if (t < 1.0f)
+        {
+            return 0.5f * t * t;
+        }
+        t = 2.0f - t;
+        return 1.0f - 0.5f * t * t;
+    }
+}
+
+TweenManager* TweenManager::s_instance = nullptr;
+
+TweenManager* TweenManager::getInstance()
+{
+    if (!s_instance)
+    {
+        s_instance = new TweenManager();
+    }
+    return s_instance;
+}
+
+void TweenManager::destroyInstance()
+{
+    CC_SAFE_DELETE(s_instance);
+}
+
+TweenManager::TweenManager()
+    : _activeCount(0)
+    , _scheduled(false)
+    , _updating(false)
+{
+    // 预先建好记录池，稳定运行时只在空闲列表中取放
+    int capacity = GameConfig::AnimationSettings::TWEEN_POOL_CAPACITY;
+    _tweens.resize(capacity);
+    _freeSlots.reserve(capacity);
+    for (int i = capacity - 1; i >= 0; i--)
+    {
+        _freeSlots.push_back(i);
+    }
+}
+
+TweenManager::~TweenManager()
+{
+    if (_scheduled)
+    {
+        Director::getInstance()->getScheduler()->unscheduleUpdate(this);
+    }
+    for (auto& tween : _tweens)
+    {
+        if (tween.active)
+        {
+            tween.target->release();
+        }
+    }
+}
+
+void TweenManager::moveTo(Node* target, const Vec2& position, float duration, const Callback& onComplete)
+{
+    int index = acquire(target, MOVE, duration, onComplete);
+    if (index < 0)
+    {
+        return;
+    }
+    Tween& tween = _tweens[index];
+    tween.from = target->getPosition();
+    tween.to = position;
+    tween.previous = tween.from;
+}
+
+void TweenManager::flip(Node* target, float duration, float bounceScale, float bounceDuration,
+                        const Callback& onMidpoint, const Callback& onComplete)
+{
+    stop(target, FLIP);
+    int index = acquire(target, FLIP, duration, onComplete);
+    if (index < 0)
+    {
+        return;
+    }
+    Tween& tween = _tweens[index];
+    tween.secondary = bounceDuration;
+    tween.amount = bounceScale;
+    tween.from = Vec2(target->getScaleX(), target->getScaleY());
+    tween.onMidpoint = onMidpoint;
+}
+
+void TweenManager::bounce(Node* target, float scale, float halfDuration, int repeats,
+                          const Color3B& tint, const Callback& onComplete)
+{
+    int index = acquire(target, BOUNCE, halfDuration, onComplete);
+    if (index < 0)
+    {
+        return;
+    }
+    Tween& tween = _tweens[index];
+    tween.amount = scale;
+    tween.repeats = repeats > 0 ? repeats : 1;
+    tween.tint = tint;
+}
+
+void TweenManager::shake(Node* target, float amplitude, float duration, const Callback& onComplete)
+{
+    int index = acquire(target, SHAKE, duration, onComplete);
+    if (index < 0)
+    {
+        return;
+    }
+    _tweens[index].amount = amplitude;
+}
+
+void TweenManager::stop(Node* target, Type type)
+{
+    for (size_t i = 0; i < _tweens.size(); i++)
+    {
+        const Tween& tween = _tweens[i];
+        if (tween.active && tween.target == target && tween.type == type)
+        {
+            release(static_cast<int>(i));
+        }
+    }
+}
+
+void TweenManager::stopAll(Node* target)
+{
+    if (_activeCount == 0)
+    {
+        return;
+    }
+    for (size_t i = 0; i < _tweens.size(); i++)
+    {
+        const Tween& tween = _tweens[i];
+        if (tween.active && tween.target == target)
+        {
+            release(static_cast<int>(i));
+        }
+    }
+}
+
+bool TweenManager::isAnimating(const Node* target) const
+{
+    if (_activeCount == 0)
+    {
+        return false;
+    }
+    for (const auto& tween : _tweens)
+    {
+        if (tween.active && tween.target == target)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void TweenManager::update(float dt)
+{
+    if (_activeCount == 0)
+    {
+        return;
+    }
+
+    _updating = true;
+    // 回调中可能开始新的补间使数组扩容，循环中只按下标访问
+    for (size_t i = 0; i < _tweens.size(); i++)
+    {
+        Tween& tween = _tweens[i];
+        if (!tween.active)
+        {
+            continue;
+        }
+        if (tween.deferred)
+        {
+            // 本帧回调中开始的补间从下一帧开始推进
+            tween.deferred = false;
+            continue;
+        }
+        if (tween.target->getReferenceCount() == 1)
+        {
+            // 目标已被场景和视图管理器释放，只剩补间持有
+            release(static_cast<int>(i));
+            continue;
+        }
+        if (!tween.target->isRunning())
+        {
+            continue;
+        }
+        step(static_cast<int>(i), dt);
+    }
+    _updating = false;
+}
+
+void TweenManager::finishAll(Node* target)
+{
+    if (_activeCount == 0)
+    {
+        return;
+    }
+
+    // 先标记当前的补间，回调中对同一目标新开始的补间不受影响
+    for (auto& tween : _tweens)
+    {
+        tween.finishing = tween.active && tween.target == target;
+    }
+    for (size_t i = 0; i < _tweens.size(); i++)
+    {
+        Tween& tween = _tweens[i];
+        if (tween.active && tween.finishing)
+        {
+            tween.finishing = false;
+            step(static_cast<int>(i), std::numeric_limits<float>::max());
+        }
+    }
+}
+
+int TweenManager::acquire(Node* target, Type type, float duration, const Callback& onComplete)
+{
+    if (!target)
+    {
+        return -1;
+    }
+
+    int index;
+    if (_freeSlots.empty())
+    {
+        // 超出预留容量时扩充记录池
+        index = static_cast<int>(_tweens.size());
+        _tweens.push_back(Tween());
+        _freeSlots.reserve(_tweens.capacity());
+    }
+    else
+    {
+        index = _freeSlots.back();
+        _freeSlots.pop_back();
+    }
+
+    Tween& tween = _tweens[index];
+    tween.target = target;
+    tween.type = type;
+    tween.active = true;
+    tween.deferred = _updating;
+    tween.finishing = false;
+    tween.midpointFired = false;
+    tween.serial++;
+    tween.repeats = 1;
+    tween.elapsed = 0.0f;
+    tween.duration = duration;
+    tween.secondary = 0.0f;
+    tween.amount = 0.0f;
+    tween.from = Vec2::ZERO;
+    tween.to = Vec2::ZERO;
+    tween.tint = Color3B::WHITE;
+    tween.onComplete = onComplete;
+    target->retain();
+    _activeCount++;
+    if (_activityCallback)
+    {
+        _activityCallback(target);
+    }
+
+    if (!_scheduled)
+    {
+        // 调度回调只注册一次，没有补间时 update 立即返回
+        Director::getInstance()->getScheduler()->scheduleUpdate(this, 0, false);
+        _scheduled = true;
+    }
+    return index;
+}
+
+void TweenManager::release(int index)
+{
+    Tween& tween = _tweens[index];
+    tween.active = false;
+    tween.onMidpoint = nullptr;
+    tween.onComplete = nullptr;
+    _freeSlots.push_back(index);
+    _activeCount--;
+
+    // 通知时记录已标为结束、目标仍被持有
+    Node* target = tween.target;
+    tween.target = nullptr;
+    if (_activityCallback)
+    {
+        _activityCallback(target);
+    }
+    target->release();
+}
+
+void TweenManager::step(int index, float dt)
+{
+    Tween& tween = _tweens[index];
+    tween.elapsed += dt;
+    bool finished = apply(tween);
+
+    if (tween.type == FLIP && !tween.midpointFired && tween.elapsed >= tween.duration * 0.5f)
+    {
+        tween.midpointFired = true;
+        uint32_t serial = tween.serial;
+        Callback midpoint;
+        midpoint.swap(tween.onMidpoint);
+        if (midpoint)
+        {
+            midpoint();
+        }
+        // 回调中可能停止了该补间，空出的记录又可能被新的补间占用；调用回调后不再使用之前的引用
+        if (!_tweens[index].active || _tweens[index].serial != serial)
+        {
+            return;
+        }
+    }
+
+    if (finished)
+    {
+        Node* target = _tweens[index].target;
+        Callback complete;
+        complete.swap(_tweens[index].onComplete);
+        target->retain();
+        release(index);
+        if (complete)
+        {
+            complete();
+        }
+        target->release();
+    }
+}
+
+bool TweenManager::apply(Tween& tween)
+{
+    Node* target = tween.target;
+    switch (tween.type)
+    {
+        case MOVE:
+        {
+            Vec2 shift = target->getPosition() - tween.previous;
+            tween.from = tween.from + shift;
+            tween.to = tween.to + shift;
+            float t = progress(tween.elapsed, tween.duration);
+            tween.previous = tween.from + (tween.to - tween.from) * t;
+            target->setPosition(tween.previous);
+            return t >= 1.0f;
+        }
+        case FLIP:
+        {
+            // 前半程从起始缩放收拢到0，后半程展开到1，随后弹跳一个来回
+            float half = tween.duration * 0.5f;
+            float elapsed = tween.elapsed;
+            if (elapsed < half)
+            {
+                float t = easeInOut(progress(elapsed, half));
+                target->setScale(tween.from.x * (1.0f - t), tween.from.y + (1.0f - tween.from.y) * t);
+                return false;
+            }
+            if (elapsed < tween.duration)
+            {
+                target->setScale(easeInOut(progress(elapsed - half, half)), 1.0f);
+                return false;
+            }
+            elapsed -= tween.duration;
+            if (elapsed < tween.secondary)
+            {
+                target->setScale(1.0f + (tween.amount - 1.0f) * progress(elapsed, tween.secondary));
+                return false;
+            }
+            elapsed -= tween.secondary;
+            if (elapsed < tween.secondary)
+            {
+                target->setScale(tween.amount + (1.0f - tween.amount) * progress(elapsed, tween.secondary));
+                return false;
+            }
+            target->setScale(1.0f);
+            return true;
+        }
+        case BOUNCE:
+        {
+            float cycle = tween.duration * 2.0f;
+            if (cycle <= 0.0f || tween.elapsed >= cycle * tween.repeats)
+            {
+                target->setScale(1.0f);
+                target->setColor(Color3B::WHITE);
+                return true;
+            }
+            float local = std::fmod(tween.elapsed, cycle);
+            float k = local < tween.duration ? local / tween.duration : 2.0f - local / tween.duration;
+            target->setScale(1.0f + (tween.amount - 1.0f) * k);
+            target->setColor(Color3B(static_cast<GLubyte>(255 + (tween.tint.r - 255) * k),
+                                     static_cast<GLubyte>(255 + (tween.tint.g - 255) * k),
+                                     static_cast<GLubyte>(255 + (tween.tint.b - 255) * k)));
+            return false;
+        }
+        case SHAKE:
+        {
+            // 右移1/4时长，左移1/2时长，再用1/4时长回到原位；每帧只施加偏移的增量
+            float t = progress(tween.elapsed, tween.duration);
+            float offset;
+            if (t < 0.25f)
+            {
+                offset = tween.amount * (t / 0.25f);
+            }
+            else if (t < 0.75f)
+            {
+                offset = tween.amount * (1.0f - 2.0f * (t - 0.25f) / 0.5f);
+            }
+            else
+            {
+                offset = -tween.amount * (1.0f - (t - 0.75f) / 0.25f);
+            }
+            target->setPositionX(target->getPositionX() + offset - tween.from.x);
+            tween.from.x = offset;
+            return t >= 1.0f;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,163 @@
+#ifndef __TWEEN_MANAGER_H__
+#define __TWEEN_MANAGER_H__
+
+#include "cocos2d.h"
+#include <functional>
+#include <vector>
+
+USING_NS_CC;
+
+/**
+ * 补间动画管理器
+ * 职责：以扁平的补间记录代替每次操作新建的 Sequence/Spawn/CallFunc 动作树，所有补间在同一个调度回调中推进
+ * 内存：记录存放在预留容量的数组中，结束后放回空闲列表复用；稳定运行时开始、推进、结束补间都不分配内存
+ *       （回调为 std::function，只捕获一两个指针/整数的 lambda 存放在其内部缓冲区中，不会分配）
+ * 生命周期：补间期间持有目标节点的引用；目标只剩补间持有时丢弃该补间（不回调），目标不在运行中时暂停推进，
+ *           与 cocos2d-x 动作随节点清理/暂停的行为一致
+ */
+class TweenManager
+{
+public:
+    // 补间类型
+    enum Type
+    {
+        MOVE = 0,       // 直线移动到目标位置
+        FLIP,           // 横向缩放到0再恢复，中点切换牌面，结束时轻微弹跳
+        BOUNCE,         // 放大再恢复，可同时着色（提示高亮）
+        SHAKE           // 左右摇摆后回到原位（匹配失败）
+    };
+
+    typedef std::function<void()> Callback;
+
+    // 补间开始/结束通知，参数为目标节点（结束时目标上可能还有其他补间）
+    typedef std::function<void(Node* target)> ActivityCallback;
+
+private:
+    // 补间记录，各类型共用同一结构
+    struct Tween
+    {
+        Node* target;           // 目标节点（持有引用）
+        Type type;
+        bool active;
+        bool deferred;          // 在 update 的回调中开始，本帧不推进
+        bool finishing;         // finishAll 待处理
+        bool midpointFired;     // FLIP：是否已触发中点回调
+        uint32_t serial;        // 每次取出记录时递增，用于识别回调后记录是否已被新的补间占用
+        int repeats;            // BOUNCE：往返次数
+        float elapsed;          // 已推进时间
+        float duration;         // MOVE/SHAKE：总时长；FLIP：翻转时长；BOUNCE：单程时长
+        float secondary;        // FLIP：弹跳单程时长
+        float amount;           // FLIP/BOUNCE：弹跳缩放；SHAKE：幅度
+        Vec2 from;              // MOVE：起点；SHAKE：上一帧已施加的偏移
+        Vec2 to;                // MOVE：终点
+        Vec2 previous;          // MOVE：上一帧设置的位置，期间其他补间造成的位移叠加到起点和终点上
+        Color3B tint;           // BOUNCE：着色
+        Callback onMidpoint;    // FLIP：牌面切换
+        Callback onComplete;    // 结束回调
+
+        Tween() : target(nullptr), type(MOVE), active(false), deferred(false), finishing(false), midpointFired(false),
+                  serial(0), repeats(1), elapsed(0.0f), duration(0.0f), secondary(0.0f), amount(0.0f) {}
+    };
+
+    static TweenManager* s_instance;
+
+    std::vector<Tween> _tweens;         // 补间记录池
+    std::vector<int> _freeSlots;        // 空闲记录下标
+    int _activeCount;                   // 进行中的补间数
+    bool _scheduled;                    // 是否已注册调度回调
+    bool _updating;                     // 是否正在 update 中
+    ActivityCallback _activityCallback; // 补间开始/结束通知，可为空
+
+public:
+    static TweenManager* getInstance();
+    static void destroyInstance();
+
+    /**
+     * 直线移动（等同 MoveTo，可与摇摆等相对移动叠加）
+     * @param target 目标节点
+     * @param position 终点
+     * @param duration 时长
+     * @param onComplete 结束回调
+     */
+    void moveTo(Node* target, const Vec2& position, float duration, const Callback& onComplete = nullptr);
+
+    /**
+     * 翻牌：横向缩放到0（缓入缓出），中点回调切换牌面，再缩放回来，最后弹跳一次
+     * 同一目标上已有的翻牌补间会被停止（不回调）
+     * @param target 目标节点
+     * @param duration 翻转时长（不含弹跳）
+     * @param bounceScale 弹跳缩放
+     * @param bounceDuration 弹跳单程时长
+     * @param onMidpoint 中点回调
+     * @param onComplete 结束回调
+     */
+    void flip(Node* target, float duration, float bounceScale, float bounceDuration,
+              const Callback& onMidpoint, const Callback& onComplete = nullptr);
+
+    /**
+     * 放大再恢复，可同时着色
+     * @param target 目标节点
+     * @param scale 最大缩放
+     * @param halfDuration 单程时长
+     * @param repeats 往返次数
+     * @param tint 最大缩放时的颜色（白色为不着色）
+     * @param onComplete 结束回调
+     */
+    void bounce(Node* target, float scale, float halfDuration, int repeats,
+                const Color3B& tint = Color3B::WHITE, const Callback& onComplete = nullptr);
+
+    /**
+     * 左右摇摆：右移 amplitude，左移 2*amplitude，再回到原位（相对移动，可与其他补间叠加）
+     * @param target 目标节点
+     * @param amplitude 幅度
+     * @param duration 总时长
+     * @param onComplete 结束回调
+     */
+    void shake(Node* target, float amplitude, float duration, const Callback& onComplete = nullptr);
+
+    // 停止目标上指定类型的补间，不触发回调
+    void stop(Node* target, Type type);
+
+    // 停止目标上的所有补间，不触发回调
+    void stopAll(Node* target);
+
+    // 使目标上的所有补间立即到达终点，按正常结束处理（触发中点和结束回调）
+    void finishAll(Node* target);
+
+    // 目标上是否有进行中的补间
+    bool isAnimating(const Node* target) const;
+
+    // 进行中的补间数
+    int getActiveCount() const { return _activeCount; }
+
+    /**
+     * 设置补间开始/结束通知（例如静态层缓存据此切换实时/缓存绘制），传入nullptr取消
+     * 回调中不应开始或停止补间
+     * @param callback 通知回调
+     */
+    void setActivityCallback(const ActivityCallback& callback) { _activityCallback = callback; }
+
+    // 推进所有补间（由调度器每帧调用）
+    void update(float dt);
+
+private:
+    TweenManager();
+    ~TweenManager();
+
+    // 取出空闲记录并初始化公共字段，返回下标
+    int acquire(Node* target, Type type, float duration, const Callback& onComplete);
+
+    // 结束记录：释放目标引用并放回空闲列表
+    void release(int index);
+
+    // 推进一条补间，按需触发中点和结束回调
+    void step(int index, float dt);
+
+    /**
+     * 按已推进时间设置目标的属性
+     * @return 补间是否已结束
+     */
+    bool apply(Tween& tween);
+};
+
+#endif // __TWEEN_MANAGER_H__
@@ -27,14 +27,20 @@ bool CardModel::isBlack() const
 
 std::string CardModel::getValueString() const
 {
-    switch (_value)
+    // 非法数值保留原有的数字形式，便于日志排查
+    if (_value < ACE || _value > KING)
     {
-        case ACE: return "A";
-        case JACK: return "J";
-        case QUEEN: return "Q";
-        case KING: return "K";
-        default: return std::to_string(_value);
+        return std::to_string(_value);
     }
+    return getValueName(_value);
+}
+
+const char* CardModel::getValueName(Value value)
+{
+    static const char* const VALUE_NAMES[] = {
+        "A", "2", "3", "4", "5", "6", "7", "8", "9", "10", "J", "Q", "K"
+    };
+    return (value >= ACE && value <= KING) ? VALUE_NAMES[value - ACE] : "?";
 }
 
 bool CardModel::operator==(const CardModel& other) const
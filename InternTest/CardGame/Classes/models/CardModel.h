@@ -63,6 +63,13 @@ public:
     
     // 获取数值字符串表示
     std::string getValueString() const;
+
+    /**
+     * 数值的名称（A、2-10、J、Q、K），与数值图片文件名一致
+     * @param value 卡牌数值
+     * @return 静态字符串，数值非法时返回 "?"（不冒充某个合法数值）
+     */
+    static const char* getValueName(Value value);
     
     // 比较操作
     bool operator==(const CardModel& other) const;
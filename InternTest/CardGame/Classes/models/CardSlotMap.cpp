@@ -0,0 +1,74 @@
+#include "CardSlotMap.h"
+
+void CardSlotMap::bind(int cardId, Zone zone, int index)
+{
+    if (cardId < 0)
+    {
+        return;
+    }
+
+    if (cardId >= static_cast<int>(_slots.size()))
+    {
+        Slot emptySlot = { ZONE_NONE, -1, 0 };
+        _slots.resize(cardId + 1, emptySlot);
+    }
+
+    _slots[cardId].zone = zone;
+    _slots[cardId].index = index;
+}
+
+void CardSlotMap::unbind(int cardId)
+{
+    if (cardId < 0 || cardId >= static_cast<int>(_slots.size()))
+    {
+        return;
+    }
+
+    Slot& slot = _slots[cardId];
+    slot.zone = ZONE_NONE;
+    slot.index = -1;
+    slot.generation++;
+}
+
+CardSlotMap::Zone CardSlotMap::getZone(int cardId) const
+{
+    if (cardId < 0 || cardId >= static_cast<int>(_slots.size()))
+    {
+        return ZONE_NONE;
+    }
+    return _slots[cardId].zone;
+}
+
+int CardSlotMap::getIndex(int cardId) const
+{
+    return getZone(cardId) == ZONE_NONE ? -1 : _slots[cardId].index;
+}
+
+CardSlotMap::Handle CardSlotMap::getHandle(int cardId) const
+{
+    Handle handle = { cardId, 0 };
+    if (getZone(cardId) != ZONE_NONE)
+    {
+        handle.generation = _slots[cardId].generation;
+    }
+    return handle;
+}
+
+bool CardSlotMap::isValid(const Handle& handle) const
+{
+    return getZone(handle.cardId) != ZONE_NONE && _slots[handle.cardId].generation == handle.generation;
+}
+
+void CardSlotMap::clear()
+{
+    // 保留容量，重开游戏时不重新分配
+    for (auto& slot : _slots)
+    {
+        if (slot.zone != ZONE_NONE)
+        {
+            slot.zone = ZONE_NONE;
+            slot.index = -1;
+            slot.generation++;
+        }
+    }
+}
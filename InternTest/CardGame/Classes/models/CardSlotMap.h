@@ -0,0 +1,60 @@
+#ifndef __CARD_SLOT_MAP_H__
+#define __CARD_SLOT_MAP_H__
+
+#include <vector>
+
+/**
+ * 卡牌槽位表
+ * 职责：以卡牌ID为键，记录每张卡牌所在的区域及其在区域栈中的下标，
+ *       使按ID查找、移除和点击分类都为常数时间；
+ *       卡牌离开模型时槽位代数递增，旧句柄随之失效
+ */
+class CardSlotMap
+{
+public:
+    // 卡牌所在区域
+    enum Zone {
+        ZONE_NONE = 0,     // 不在模型中
+        ZONE_MAIN,         // 主牌区
+        ZONE_BOTTOM,       // 底牌区
+        ZONE_SPARE         // 备用区
+    };
+
+    // 带代数的卡牌句柄
+    struct Handle
+    {
+        int cardId;
+        unsigned int generation;
+    };
+
+private:
+    struct Slot
+    {
+        Zone zone;                  // 所在区域
+        int index;                  // 在区域栈中的下标
+        unsigned int generation;    // 槽位代数
+    };
+
+    std::vector<Slot> _slots;       // 以卡牌ID为下标的槽位数组
+
+public:
+    // 卡牌进入某区域（或在区域间移动）
+    void bind(int cardId, Zone zone, int index);
+
+    // 卡牌离开模型，使其句柄失效
+    void unbind(int cardId);
+
+    // 更新卡牌在区域栈中的下标
+    void setIndex(int cardId, int index) { _slots[cardId].index = index; }
+
+    // 查询
+    Zone getZone(int cardId) const;
+    int getIndex(int cardId) const;
+    Handle getHandle(int cardId) const;
+    bool isValid(const Handle& handle) const;
+
+    // 所有卡牌离开模型
+    void clear();
+};
+
+#endif // __CARD_SLOT_MAP_H__
@@ -1,30 +1,88 @@
 #include "GameModel.h"
+#include "ZobristKeys.h"
 #include <algorithm>
 
 GameModel::GameModel()
-    : _score(0), _gameState(PLAYING), _level(1), _moves(0), _nextCardId(1)
+    : _score(0), _gameState(PLAYING), _level(1), _moves(0), _nextCardId(1), _seed(0)
+    , _layout(&TableauLayout::getLayout(TableauLayout::FLAT))
+    , _recordingChanges(false)
+    , _hash(0), _rankHash(0)
 {
 }
 
+void GameModel::setLayout(const TableauLayout& layout)
+{
+    clearStack(_mainCardStack);
+    _layout = &layout;
+    _coverCounts.assign(layout.getSlotCount(), 0);
+    _slotCards.assign(layout.getSlotCount(), -1);
+}
+
+bool GameModel::isCardClickable(const CardModel& card) const
+{
+    if (_slotMap.getZone(card.getId()) != CardSlotMap::ZONE_MAIN)
+    {
+        return true;
+    }
+    return getCoverCount(card.getGridIndex()) == 0;
+}
+
+void GameModel::updateCoverCounts(int gridIndex, int delta)
+{
+    for (int slot : _layout->getCoveredSlots(gridIndex))
+    {
+        bool wasCovered = _coverCounts[slot] != 0;
+        _coverCounts[slot] = static_cast<uint8_t>(_coverCounts[slot] + delta);
+        if (wasCovered != (_coverCounts[slot] != 0) && _slotCards[slot] >= 0)
+        {
+            // 槽位上的主牌被覆盖或露出
+            int rank = findCard(_slotCards[slot])->getValue();
+            if (wasCovered)
+            {
+                _uncoveredRanks.add(rank);
+            }
+            else
+            {
+                _uncoveredRanks.remove(rank);
+            }
+            recordChange(_slotCards[slot]);
+        }
+    }
+}
+
+void GameModel::beginChangeSet()
+{
+    _changeSet.clear();
+    _recordingChanges = true;
+}
+
+void GameModel::recordChange(int cardId)
+{
+    // 一次操作只涉及少数几张牌，线性去重即可
+    if (_recordingChanges && std::find(_changeSet.begin(), _changeSet.end(), cardId) == _changeSet.end())
+    {
+        _changeSet.push_back(cardId);
+    }
+}
+
 // 新的统一栈式接口
 void GameModel::addToMainStack(const CardModel& card)
 {
     CardModel newCard = card;
     newCard.setFaceUp(true);  // 主牌栈的卡牌正面朝上
-    _mainCardStack.push_back(newCard);
+    pushCard(CardSlotMap::ZONE_MAIN, newCard);
 }
 
 void GameModel::removeFromMainStack(int cardId)
 {
-    auto it = std::find_if(_mainCardStack.begin(), _mainCardStack.end(),
-        [cardId](const CardModel& card) {
-            return card.getId() == cardId;
-        });
-
-    if (it != _mainCardStack.end())
+    if (_slotMap.getZone(cardId) != CardSlotMap::ZONE_MAIN)
     {
-        _mainCardStack.erase(it);
+        return;
     }
+
+    // 与末尾交换后弹出，常数时间
+    detachCard(cardId, nullptr);
+    _slotMap.unbind(cardId);
 }
 
 // 兼容性接口实现
@@ -32,7 +90,7 @@ void GameModel::removeMainCard(int index)
 {
     if (index >= 0 && index < static_cast<int>(_mainCardStack.size()))
     {
-        _mainCardStack.erase(_mainCardStack.begin() + index);
+        removeFromMainStack(_mainCardStack[index].getId());
     }
 }
 
@@ -41,46 +99,112 @@ void GameModel::removeMainCardById(int cardId)
     removeFromMainStack(cardId);  // 委托给统一接口
 }
 
-CardModel* GameModel::getMainCardById(int cardId)
+void GameModel::setMainCards(const std::vector<CardModel>& cards)
 {
-    auto it = std::find_if(_mainCardStack.begin(), _mainCardStack.end(),
-        [cardId](const CardModel& card) {
-            return card.getId() == cardId;
-        });
+    clearStack(_mainCardStack);
+    for (const auto& card : cards)
+    {
+        pushCard(CardSlotMap::ZONE_MAIN, card);
+    }
+}
 
-    return (it != _mainCardStack.end()) ? &(*it) : nullptr;
+void GameModel::addMainCard(const CardModel& card)
+{
+    pushCard(CardSlotMap::ZONE_MAIN, card);
+}
+
+CardModel* GameModel::getMainCardById(int cardId)
+{
+    if (_slotMap.getZone(cardId) != CardSlotMap::ZONE_MAIN)
+    {
+        return nullptr;
+    }
+    return &_mainCardStack[_slotMap.getIndex(cardId)];
 }
 
 const CardModel* GameModel::getMainCardById(int cardId) const
 {
-    auto it = std::find_if(_mainCardStack.begin(), _mainCardStack.end(),
-        [cardId](const CardModel& card) {
-            return card.getId() == cardId;
-        });
+    if (_slotMap.getZone(cardId) != CardSlotMap::ZONE_MAIN)
+    {
+        return nullptr;
+    }
+    return &_mainCardStack[_slotMap.getIndex(cardId)];
+}
 
-    return (it != _mainCardStack.end()) ? &(*it) : nullptr;
+const CardModel* GameModel::findCard(int cardId) const
+{
+    switch (_slotMap.getZone(cardId))
+    {
+        case CardSlotMap::ZONE_MAIN: return &_mainCardStack[_slotMap.getIndex(cardId)];
+        case CardSlotMap::ZONE_BOTTOM: return &_bottomCardStack[_slotMap.getIndex(cardId)];
+        case CardSlotMap::ZONE_SPARE: return &_spareCardStack[_slotMap.getIndex(cardId)];
+        default: return nullptr;
+    }
 }
 
-bool GameModel::isGameWon() const
+const CardModel* GameModel::resolveHandle(const CardSlotMap::Handle& handle) const
 {
-    // DEMO模式：总是返回false，避免游戏胜利判定
-    return false;
+    return _slotMap.isValid(handle) ? findCard(handle.cardId) : nullptr;
+}
 
-    /*
-    // 原始的游戏胜利判定逻辑
-    return _mainCards.empty() && _gameState == WIN;
-    */
+bool GameModel::isStackTop(int cardId) const
+{
+    switch (_slotMap.getZone(cardId))
+    {
+        case CardSlotMap::ZONE_BOTTOM:
+            return _slotMap.getIndex(cardId) == static_cast<int>(_bottomCardStack.size()) - 1;
+        case CardSlotMap::ZONE_SPARE:
+            return _slotMap.getIndex(cardId) == static_cast<int>(_spareCardStack.size()) - 1;
+        default:
+            return false;
+    }
 }
 
 bool GameModel::isGameOver() const
 {
-    // DEMO模式：总是返回false，避免游戏结束判定
-    return false;
+    return !_mainCardStack.empty()
+        && (RankIndex::getNeighbours(_stockRanks.getMask()) & _uncoveredRanks.getMask()) == 0;
+}
+
+void GameModel::countCard(CardSlotMap::Zone zone, const CardModel& card, bool add)
+{
+    if (zone == CardSlotMap::ZONE_MAIN)
+    {
+        if (getCoverCount(card.getGridIndex()) != 0)
+        {
+            return;
+        }
+        if (add)
+        {
+            _uncoveredRanks.add(card.getValue());
+        }
+        else
+        {
+            _uncoveredRanks.remove(card.getValue());
+        }
+    }
+    else if (add)
+    {
+        _stockRanks.add(card.getValue());
+    }
+    else
+    {
+        _stockRanks.remove(card.getValue());
+    }
+}
+
+void GameModel::clearRankCounts()
+{
+    _uncoveredRanks.clear();
+    _stockRanks.clear();
+}
 
-    /*
-    // 原始的游戏结束判定逻辑
-    return _gameState == WIN || _gameState == LOSE;
-    */
+void GameModel::toggleKeys(CardSlotMap::Zone zone, const CardModel& card, int position)
+{
+    // CardSlotMap 的区域从 ZONE_MAIN=1 开始，ZobristKeys 的区域从 0 开始
+    int keyZone = static_cast<int>(zone) - CardSlotMap::ZONE_MAIN;
+    _hash ^= ZobristKeys::getCardKey(keyZone, position, card.getSuit(), card.getValue());
+    _rankHash ^= ZobristKeys::getRankKey(keyZone, position, card.getValue());
 }
 
 void GameModel::reset()
@@ -89,9 +213,18 @@ void GameModel::reset()
     _gameState = PLAYING;
     _moves = 0;
     _nextCardId = 1;
+    _seed = 0;
+    _journal.clear();
     _mainCardStack.clear();  // 使用新的栈式成员变量
+    std::fill(_coverCounts.begin(), _coverCounts.end(), 0);
+    std::fill(_slotCards.begin(), _slotCards.end(), -1);
+    _changeSet.clear();
+    clearRankCounts();
+    _hash = 0;
+    _rankHash = 0;
     _bottomCardStack.clear();
     _spareCardStack.clear();
+    _slotMap.clear();
 }
 
 // 新的栈式底牌管理方法
@@ -100,41 +233,305 @@ CardModel GameModel::getCurrentBottomCard() const
     return _bottomCardStack.empty() ? CardModel() : _bottomCardStack.back();
 }
 
+void GameModel::setBottomCard(const CardModel& card)
+{
+    clearStack(_bottomCardStack);
+    pushCard(CardSlotMap::ZONE_BOTTOM, card);
+}
+
+void GameModel::setSpareCard(const CardModel& card)
+{
+    clearStack(_spareCardStack);
+    pushCard(CardSlotMap::ZONE_SPARE, card);
+}
+
+void GameModel::swapBottomAndSpareCards()
+{
+    // 这个方法现在用于简单的栈顶交换（经 detachCard/pushCard，槽位、计数和哈希随之更新）
+    if (!_bottomCardStack.empty() && !_spareCardStack.empty())
+    {
+        CardModel bottomCard;
+        CardModel spareCard;
+        detachCard(_bottomCardStack.back().getId(), &bottomCard);
+        detachCard(_spareCardStack.back().getId(), &spareCard);
+        pushCard(CardSlotMap::ZONE_BOTTOM, spareCard);
+        pushCard(CardSlotMap::ZONE_SPARE, bottomCard);
+    }
+}
+
 void GameModel::moveSpareToBottom()
 {
     // 备用牌移动到底牌区（覆盖）
     if (!_spareCardStack.empty())
     {
-        CardModel spareCard = _spareCardStack.back();
-        _spareCardStack.pop_back();
+        CardModel spareCard;
+        detachCard(_spareCardStack.back().getId(), &spareCard);
 
         // 设置为正面朝上（用于匹配）
         spareCard.setFaceUp(true);
-        _bottomCardStack.push_back(spareCard);
+        pushCard(CardSlotMap::ZONE_BOTTOM, spareCard);
     }
 }
 
 void GameModel::moveBottomToSpare()
 {
     // 底牌移动到备用区
-    CardModel bottomCard = _bottomCardStack.back();
-    _bottomCardStack.pop_back();
+    if (_bottomCardStack.empty())
+    {
+        return;
+    }
+
+    CardModel bottomCard;
+    detachCard(_bottomCardStack.back().getId(), &bottomCard);
     // 设置为背面朝下
     bottomCard.setFaceUp(false);
-    _spareCardStack.push_back(bottomCard);
-    
+    pushCard(CardSlotMap::ZONE_SPARE, bottomCard);
+}
+
+void GameModel::moveMainToBottom(int cardId)
+{
+    // 匹配成功的主牌移动到底牌区，句柄保持有效
+    if (_slotMap.getZone(cardId) != CardSlotMap::ZONE_MAIN)
+    {
+        return;
+    }
+
+    CardModel mainCard;
+    detachCard(cardId, &mainCard);
+
+    mainCard.setFaceUp(true);  // 底牌应该正面朝上
+    pushCard(CardSlotMap::ZONE_BOTTOM, mainCard);
+}
+
+bool GameModel::applyMove(const GameMove& move)
+{
+    // 打出主牌时先记下原下标，撤销时放回同一位置
+    int mainIndex = move.type == GameMove::PLAY_MAIN && _slotMap.getZone(move.cardId) == CardSlotMap::ZONE_MAIN
+                  ? _slotMap.getIndex(move.cardId) : 0;
+
+    // 卡牌ID或主牌下标超出日志编码范围时拒绝执行，截断后撤销会作用到别的卡牌/位置
+    if (move.cardId < 0 || move.cardId > MoveJournal::MAX_CARD_ID || mainIndex > MoveJournal::MAX_MAIN_INDEX)
+    {
+        return false;
+    }
+    beginChangeSet();
+    bool performed = performMove(move.type, move.cardId);
+    _recordingChanges = false;
+    if (!performed)
+    {
+        return false;
+    }
+    _journal.record(MoveJournal::pack(move.type, move.cardId, mainIndex));
+    _moves++;
+    return true;
+}
+
+bool GameModel::undoMove(GameMove* outMove)
+{
+    if (!_journal.canUndo())
+    {
+        return false;
+    }
+
+    MoveJournal::Entry entry = _journal.popUndo();
+    beginChangeSet();
+    switch (MoveJournal::getType(entry))
+    {
+        case GameMove::PLAY_MAIN:
+        {
+            CardModel card;
+            detachCard(MoveJournal::getCardId(entry), &card);
+            insertMainCard(card, MoveJournal::getMainIndex(entry));
+            break;
+        }
+        case GameMove::SPARE_TO_BOTTOM: moveBottomToSpare(); break;
+        case GameMove::BOTTOM_TO_SPARE: moveSpareToBottom(); break;
+    }
+    _recordingChanges = false;
+
+    _moves--;
+    if (outMove)
+    {
+        *outMove = MoveJournal::toMove(entry);
+    }
+    return true;
+}
+
+bool GameModel::redoMove(GameMove* outMove)
+{
+    if (!_journal.canRedo())
+    {
+        return false;
+    }
+
+    MoveJournal::Entry entry = _journal.popRedo();
+    beginChangeSet();
+    performMove(MoveJournal::getType(entry), MoveJournal::getCardId(entry));
+    _recordingChanges = false;
+    _moves++;
+    if (outMove)
+    {
+        *outMove = MoveJournal::toMove(entry);
+    }
+    return true;
+}
+
+bool GameModel::performMove(GameMove::Type type, int cardId)
+{
+    switch (type)
+    {
+        case GameMove::PLAY_MAIN:
+            if (_slotMap.getZone(cardId) != CardSlotMap::ZONE_MAIN)
+            {
+                return false;
+            }
+            moveMainToBottom(cardId);
+            return true;
+        case GameMove::SPARE_TO_BOTTOM:
+            if (_spareCardStack.empty() || _spareCardStack.back().getId() != cardId)
+            {
+                return false;
+            }
+            moveSpareToBottom();
+            return true;
+        case GameMove::BOTTOM_TO_SPARE:
+            if (_bottomCardStack.empty() || _bottomCardStack.back().getId() != cardId)
+            {
+                return false;
+            }
+            moveBottomToSpare();
+            return true;
+    }
+    return false;
+}
+
+void GameModel::insertMainCard(const CardModel& card, int index)
+{
+    pushCard(CardSlotMap::ZONE_MAIN, card);
+
+    // 与 detachCard 的"末尾填补空位"互逆：新卡牌换到原下标，原下标上的卡牌回到末尾
+    int last = static_cast<int>(_mainCardStack.size()) - 1;
+    if (index >= 0 && index < last)
+    {
+        std::swap(_mainCardStack[index], _mainCardStack[last]);
+        _slotMap.setIndex(_mainCardStack[index].getId(), index);
+        _slotMap.setIndex(_mainCardStack[last].getId(), last);
+    }
 }
 
 void GameModel::addToBottomStack(const CardModel& card)
 {
     CardModel newCard = card;
     newCard.setFaceUp(true);  // 底牌栈的卡牌正面朝上
-    _bottomCardStack.push_back(newCard);
+    pushCard(CardSlotMap::ZONE_BOTTOM, newCard);
 }
 
 void GameModel::addToSpareStack(const CardModel& card)
 {
     CardModel newCard = card;
     newCard.setFaceUp(false);  // 备用栈的卡牌背面朝下
-    _spareCardStack.push_back(newCard);
+    pushCard(CardSlotMap::ZONE_SPARE, newCard);
+}
+
+std::vector<CardModel>& GameModel::getStack(CardSlotMap::Zone zone)
+{
+    switch (zone)
+    {
+        case CardSlotMap::ZONE_BOTTOM: return _bottomCardStack;
+        case CardSlotMap::ZONE_SPARE: return _spareCardStack;
+        default: return _mainCardStack;
+    }
+}
+
+void GameModel::pushCard(CardSlotMap::Zone zone, const CardModel& card)
+{
+    // 同一张卡牌只能位于一个区域，兼容先加入新区域再从旧区域移除的调用顺序
+    detachCard(card.getId(), nullptr);
+
+    std::vector<CardModel>& stack = getStack(zone);
+    stack.push_back(card);
+    _slotMap.bind(card.getId(), zone, static_cast<int>(stack.size()) - 1);
+    recordChange(card.getId());
+    countCard(zone, card, true);
+    toggleKeys(zone, card, zone == CardSlotMap::ZONE_MAIN ? card.getGridIndex() : static_cast<int>(stack.size()) - 1);
+    if (zone == CardSlotMap::ZONE_MAIN)
+    {
+        int gridIndex = card.getGridIndex();
+        if (gridIndex >= 0 && gridIndex < static_cast<int>(_slotCards.size()))
+        {
+            _slotCards[gridIndex] = card.getId();
+        }
+        updateCoverCounts(gridIndex, 1);
+    }
+}
+
+bool GameModel::detachCard(int cardId, CardModel* outCard)
+{
+    CardSlotMap::Zone zone = _slotMap.getZone(cardId);
+    if (zone == CardSlotMap::ZONE_NONE)
+    {
+        return false;
+    }
+
+    std::vector<CardModel>& stack = getStack(zone);
+    int index = _slotMap.getIndex(cardId);
+    int last = static_cast<int>(stack.size()) - 1;
+    if (outCard)
+    {
+        *outCard = stack[index];
+    }
+
+    recordChange(cardId);
+    countCard(zone, stack[index], false);
+    toggleKeys(zone, stack[index], zone == CardSlotMap::ZONE_MAIN ? stack[index].getGridIndex() : index);
+    if (zone == CardSlotMap::ZONE_MAIN)
+    {
+        int gridIndex = stack[index].getGridIndex();
+        if (gridIndex >= 0 && gridIndex < static_cast<int>(_slotCards.size()) && _slotCards[gridIndex] == cardId)
+        {
+            _slotCards[gridIndex] = -1;
+        }
+        updateCoverCounts(gridIndex, -1);
+
+        // 主牌区无序：末尾卡牌填补空位
+        if (index != last)
+        {
+            stack[index] = stack[last];
+            _slotMap.setIndex(stack[index].getId(), index);
+        }
+        stack.pop_back();
+    }
+    else
+    {
+        // 底牌区/备用区保持栈序，非栈顶移除时需要平移下标，哈希中的位置随之改变
+        stack.erase(stack.begin() + index);
+        for (int i = index; i < last; i++)
+        {
+            _slotMap.setIndex(stack[i].getId(), i);
+            toggleKeys(zone, stack[i], i + 1);
+            toggleKeys(zone, stack[i], i);
+        }
+    }
+
+    // 暂时移出区域但不改变代数，由调用方重新登记或使其失效
+    _slotMap.bind(cardId, CardSlotMap::ZONE_NONE, -1);
+    return true;
+}
+
+void GameModel::clearStack(std::vector<CardModel>& stack)
+{
+    for (size_t i = 0; i < stack.size(); i++)
+    {
+        const CardModel& card = stack[i];
+        CardSlotMap::Zone zone = _slotMap.getZone(card.getId());
+        countCard(zone, card, false);
+        toggleKeys(zone, card, zone == CardSlotMap::ZONE_MAIN ? card.getGridIndex() : static_cast<int>(i));
+        _slotMap.unbind(card.getId());
+    }
+    stack.clear();
+    if (&stack == &_mainCardStack)
+    {
+        std::fill(_coverCounts.begin(), _coverCounts.end(), 0);
+        std::fill(_slotCards.begin(), _slotCards.end(), -1);
+    }
 }
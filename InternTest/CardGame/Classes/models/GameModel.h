@@ -2,11 +2,22 @@
 #define __GAME_MODEL_H__
 
 #include "CardModel.h"
+#include "CardSlotMap.h"
+#include "GameMove.h"
+#include "MoveJournal.h"
+#include "RankIndex.h"
+#include "TableauLayout.h"
+#include <cstdint>
 #include <vector>
 
 /**
  * 游戏数据模型
  * 职责：存储游戏运行时的所有数据状态
+ * 覆盖：按牌阵布局为每个网格槽位维护"仍在主牌区且覆盖它的卡牌数"，
+ *       主牌进出主牌区时只更新它直接覆盖的槽位，可点击判定为常数时间
+ * 变更集：applyMove/undoMove/redoMove 记录本次操作影响的卡牌ID，视图只同步这些卡牌
+ * 终局：按数值维护未被覆盖的主牌张数和底牌区/备用区的卡牌张数，胜负判定为常数时间
+ * 哈希：卡牌进出区域时增量更新Zobrist哈希和忽略花色的规范哈希，与 PackedGameState 的取值一致
  */
 class GameModel
 {
@@ -22,44 +33,54 @@ public:
 private:
     std::vector<CardModel> _bottomCardStack;  // 底牌区栈（最上面的用于匹配）
     std::vector<CardModel> _spareCardStack;   // 备用区栈
-    std::vector<CardModel> _mainCardStack;    // 主牌区栈（统一栈式管理）
+    std::vector<CardModel> _mainCardStack;    // 主牌区栈（移除时与末尾交换，显示位置以gridIndex为准）
     int _score;                               // 当前分数
     GameState _gameState;                     // 游戏状态
     int _level;                               // 当前关卡
     int _moves;                               // 移动次数
     int _nextCardId;                          // 下一个卡牌ID
-    // 最小版本：注释掉层级相关的成员变量
-    // int _currentAvailableLayer;               // 当前可点击的层级
-    // std::vector<bool> _layerCleared;          // 各层是否已清空
+    uint64_t _seed;                           // 牌局种子，同一种子可复现同一副牌局
+    CardSlotMap _slotMap;                     // 卡牌ID -> 区域及栈内下标
+    MoveJournal _journal;                     // 玩家操作日志（撤销/重做）
+    const TableauLayout* _layout;             // 主牌区牌阵布局
+    std::vector<uint8_t> _coverCounts;        // 网格索引 -> 仍在主牌区且覆盖该槽位的卡牌数
+    std::vector<int> _slotCards;              // 网格索引 -> 主牌区中位于该槽位的卡牌ID，空槽为-1
+    std::vector<int> _changeSet;              // 最近一次操作影响的卡牌ID（保留容量，不重复分配）
+    bool _recordingChanges;                   // 是否正在记录变更集
+    RankIndex _uncoveredRanks;                // 未被覆盖的主牌的数值索引
+    RankIndex _stockRanks;                    // 底牌区和备用区卡牌的数值索引
+    uint64_t _hash;                           // Zobrist哈希（区域、位置、花色、数值）
+    uint64_t _rankHash;                       // 规范哈希（区域、位置、数值）
 
 public:
     GameModel();
     
     // 底牌相关（兼容性接口）
     CardModel getBottomCard() const { return getCurrentBottomCard(); }
-    void setBottomCard(const CardModel& card) {
-        _bottomCardStack.clear();
-        _bottomCardStack.push_back(card);
-    }
+    void setBottomCard(const CardModel& card);
 
     // 备用底牌相关（兼容性接口）
     CardModel getSpareCard() const {
         return _spareCardStack.empty() ? CardModel() : _spareCardStack.back();
     }
-    void setSpareCard(const CardModel& card) {
-        _spareCardStack.clear();
-        _spareCardStack.push_back(card);
-    }
+    void setSpareCard(const CardModel& card);
 
     // 兼容性方法
-    void swapBottomAndSpareCards() {
-        // 这个方法现在用于简单的栈顶交换
-        if (!_bottomCardStack.empty() && !_spareCardStack.empty()) {
-            CardModel temp = _bottomCardStack.back();
-            _bottomCardStack.back() = _spareCardStack.back();
-            _spareCardStack.back() = temp;
-        }
-    }
+    void swapBottomAndSpareCards();
+
+    // 栈顶卡牌（无拷贝），栈为空时返回nullptr
+    const CardModel* getTopBottomCard() const { return _bottomCardStack.empty() ? nullptr : &_bottomCardStack.back(); }
+    const CardModel* getTopSpareCard() const { return _spareCardStack.empty() ? nullptr : &_spareCardStack.back(); }
+
+    // 按卡牌ID查询所在区域（常数时间）
+    CardSlotMap::Zone getCardZone(int cardId) const { return _slotMap.getZone(cardId); }
+    int getCardIndex(int cardId) const { return _slotMap.getIndex(cardId); }   // 在所在区域栈中的下标
+    bool isStackTop(int cardId) const;
+    const CardModel* findCard(int cardId) const;
+
+    // 卡牌句柄：卡牌离开模型后句柄失效
+    CardSlotMap::Handle getCardHandle(int cardId) const { return _slotMap.getHandle(cardId); }
+    const CardModel* resolveHandle(const CardSlotMap::Handle& handle) const;
 
     // 底牌区管理
     const std::vector<CardModel>& getBottomCardStack() const { return _bottomCardStack; }
@@ -72,6 +93,40 @@ public:
     // 底牌区操作
     void moveSpareToBottom();    // 备用牌移动到底牌区（覆盖）
     void moveBottomToSpare();    // 底牌移动到备用区（露出下层）
+    void moveMainToBottom(int cardId);  // 主牌移动到底牌区（匹配成功）
+
+    /**
+     * 执行一次玩家操作并记入日志（清空可重做记录）
+     * @param move 操作；备用/底牌操作只作用于栈顶，cardId须为当前栈顶
+     * @return 操作是否已执行（不检查数值匹配规则，由 GameLogicService 负责）；
+     *         卡牌ID超出 MoveJournal::MAX_CARD_ID 或主牌下标超出 MoveJournal::MAX_MAIN_INDEX 时不执行
+     */
+    bool applyMove(const GameMove& move);
+
+    /**
+     * 撤销最近一次操作
+     * @param outMove 输出被撤销的操作，可为nullptr
+     * @return 是否有可撤销的操作
+     */
+    bool undoMove(GameMove* outMove = nullptr);
+
+    /**
+     * 重做最近一次被撤销的操作
+     * @param outMove 输出被重做的操作，可为nullptr
+     * @return 是否有可重做的操作
+     */
+    bool redoMove(GameMove* outMove = nullptr);
+
+    /**
+     * 最近一次 applyMove/undoMove/redoMove 影响的卡牌ID：移动的卡牌，以及覆盖状态随之改变的主牌
+     * 下一次操作开始时清空；其他修改接口（发牌、直接移动等）不记录，由调用方整体同步
+     * @return 卡牌ID列表，不含重复
+     */
+    const std::vector<int>& getLastChangeSet() const { return _changeSet; }
+
+    bool canUndo() const { return _journal.canUndo(); }
+    bool canRedo() const { return _journal.canRedo(); }
+    const MoveJournal& getJournal() const { return _journal; }
 
     // 初始化底牌区
     void addToBottomStack(const CardModel& card);
@@ -81,12 +136,12 @@ public:
     const std::vector<CardModel>& getMainCardStack() const { return _mainCardStack; }
     void addToMainStack(const CardModel& card);
     void removeFromMainStack(int cardId);
-    void clearMainStack() { _mainCardStack.clear(); }
+    void clearMainStack() { clearStack(_mainCardStack); }
 
     // 主牌区相关（兼容性接口）
     const std::vector<CardModel>& getMainCards() const { return _mainCardStack; }
-    void setMainCards(const std::vector<CardModel>& cards) { _mainCardStack = cards; }
-    void addMainCard(const CardModel& card) { _mainCardStack.push_back(card); }
+    void setMainCards(const std::vector<CardModel>& cards);
+    void addMainCard(const CardModel& card);
     void removeMainCard(int index);
     void removeMainCardById(int cardId);
     CardModel* getMainCardById(int cardId);
@@ -96,25 +151,108 @@ public:
     // 游戏状态相关
     GameState getGameState() const { return _gameState; }
     void setGameState(GameState state) { _gameState = state; }
+    int getMoves() const { return _moves; }
     
     // 卡牌ID管理
     int getNextCardId() { return _nextCardId++; }
 
-    // 最小版本：返回true
-    bool isCardClickable(const CardModel& card) const { return true; }  // 最小版本：总是可点击
+    // 牌局种子（由 CardGeneratorService 发牌时写入）
+    uint64_t getSeed() const { return _seed; }
+    void setSeed(uint64_t seed) { _seed = seed; }
+
+    /**
+     * 设置主牌区牌阵布局（清空主牌区，须在发牌前调用；reset 保留布局）
+     * @param layout 布局实例，见 TableauLayout::getLayout
+     */
+    void setLayout(const TableauLayout& layout);
+    const TableauLayout& getLayout() const { return *_layout; }
+
+    // 覆盖某网格槽位且仍在主牌区的卡牌数，超出布局槽位范围时为0
+    int getCoverCount(int gridIndex) const
+    {
+        return gridIndex >= 0 && gridIndex < static_cast<int>(_coverCounts.size()) ? _coverCounts[gridIndex] : 0;
+    }
+
+    // 主牌区卡牌未被覆盖时可点击；底牌区/备用区的卡牌总是可点击
+    bool isCardClickable(const CardModel& card) const;
 
-    // 游戏状态检查
-    bool isGameWon() const;
+    // 游戏状态检查（常数时间）
+    // 胜利：主牌区已清空
+    bool isGameWon() const { return _mainCardStack.empty(); }
+
+    /**
+     * 死局：底牌区和备用区可以来回翻动，任何一张都能翻到底牌栈顶，
+     * 因此当其中没有一张与某张未被覆盖的主牌数值相邻时，再也无法打出主牌
+     * @return 主牌区未清空且已成死局
+     */
     bool isGameOver() const;
 
+    // 数值掩码（第r位表示数值r）
+    uint16_t getUncoveredRankMask() const { return _uncoveredRanks.getMask(); }
+    uint16_t getStockRankMask() const { return _stockRanks.getMask(); }
+
+    /**
+     * 局面哈希（见 ZobristKeys）：主牌按网格索引、底牌区/备用区按栈内下标取键，
+     * 与卡牌ID、主牌区栈内顺序和正反面无关
+     * @return 与 PackedGameState::getHash 相同的值
+     */
+    uint64_t getHash() const { return _hash; }
+
+    /**
+     * 规范哈希：匹配只看数值，仅花色不同的局面可解性和提示都相同，共用同一个键
+     * 用于求解缓存、提示缓存和重复牌局检测
+     * @return 与 PackedGameState::getCanonicalHash 相同的值
+     */
+    uint64_t getCanonicalHash() const { return _rankHash; }
+
     // 重置游戏
     void reset();
 
     // 清空主牌区（兼容性接口）
-    void clearMainCards() { _mainCardStack.clear(); }
+    void clearMainCards() { clearStack(_mainCardStack); }
 
     // 清空备用底牌
-    void clearSpareCard() { _spareCardStack.clear(); }
+    void clearSpareCard() { clearStack(_spareCardStack); }
+
+    // 清空底牌区
+    void clearBottomStack() { clearStack(_bottomCardStack); }
+
+private:
+    // 区域对应的卡牌栈
+    std::vector<CardModel>& getStack(CardSlotMap::Zone zone);
+
+    // 将卡牌压入区域栈并登记槽位（卡牌若已在其他区域则先移出）
+    void pushCard(CardSlotMap::Zone zone, const CardModel& card);
+
+    // 执行操作但不写日志，返回是否执行
+    bool performMove(GameMove::Type type, int cardId);
+
+    // 将卡牌放回主牌区指定下标（打出主牌的逆操作，原下标上的卡牌移回末尾）
+    void insertMainCard(const CardModel& card, int index);
+
+    // 将卡牌从当前区域栈中取出（不改变句柄代数），返回是否找到
+    bool detachCard(int cardId, CardModel* outCard);
+
+    // 清空某个区域栈并使其中卡牌的句柄失效
+    void clearStack(std::vector<CardModel>& stack);
+
+    // 主牌进出主牌区：更新它直接覆盖的槽位的计数，覆盖状态改变的卡牌记入变更集
+    void updateCoverCounts(int gridIndex, int delta);
+
+    // 卡牌进出某区域时更新数值计数（主牌只统计未被覆盖的）
+    void countCard(CardSlotMap::Zone zone, const CardModel& card, bool add);
+
+    // 清空全部数值计数
+    void clearRankCounts();
+
+    // 将位于某区域某位置的卡牌异或进/出两个哈希（主牌区位置为网格索引）
+    void toggleKeys(CardSlotMap::Zone zone, const CardModel& card, int position);
+
+    // 开始记录一次操作的变更集
+    void beginChangeSet();
+
+    // 记入变更集（未在记录时无操作）
+    void recordChange(int cardId);
 };
 
 #endif // __GAME_MODEL_H__
@@ -0,0 +1,27 @@
+#ifndef __GAME_MOVE_H__
+#define __GAME_MOVE_H__
+
+/**
+ * 玩家操作描述
+ * 职责：描述一次对游戏模型的操作，供求解器输出解法、提示和回放使用
+ */
+struct GameMove
+{
+    // 操作类型
+    enum Type {
+        PLAY_MAIN = 0,      // 主牌匹配后移到底牌区
+        SPARE_TO_BOTTOM,    // 备用牌翻到底牌区
+        BOTTOM_TO_SPARE     // 底牌退回备用区
+    };
+
+    Type type;      // 操作类型
+    int cardId;     // 被移动的卡牌ID
+
+    GameMove() : type(PLAY_MAIN), cardId(0) {}
+    GameMove(Type moveType, int id) : type(moveType), cardId(id) {}
+
+    bool operator==(const GameMove& other) const { return type == other.type && cardId == other.cardId; }
+    bool operator!=(const GameMove& other) const { return !(*this == other); }
+};
+
+#endif // __GAME_MOVE_H__
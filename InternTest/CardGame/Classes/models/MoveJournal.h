@@ -0,0 +1,86 @@
+#ifndef __MOVE_JOURNAL_H__
+#define __MOVE_JOURNAL_H__
+
+#include "GameMove.h"
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+/**
+ * 操作日志
+ * 职责：按顺序记录对游戏模型的操作，支持常数时间的撤销与重做
+ * 存储：每条记录为4字节的压缩增量，不保存状态副本
+ *   位 0-1   操作类型（GameMove::Type）
+ *   位 2-11  主牌区下标（仅打出主牌时有效，撤销时按原下标放回）
+ *   位 12-31 卡牌ID
+ * 游标之前的记录可撤销，游标之后的记录可重做；记录新操作时丢弃可重做部分
+ */
+class MoveJournal
+{
+public:
+    typedef uint32_t Entry;
+
+    static const int MAX_MAIN_INDEX = 0x3FF;
+    static const int MAX_CARD_ID = 0xFFFFF;
+
+    /**
+     * 压缩一条记录
+     * @param type 操作类型
+     * @param cardId 被移动的卡牌ID
+     * @param mainIndex 打出主牌前该牌在主牌区的下标，其他操作传0
+     * @return 压缩后的记录
+     * 注意：cardId 须在 [0, MAX_CARD_ID] 内、mainIndex 须在 [0, MAX_MAIN_INDEX] 内，不做截断（见 GameModel::applyMove）
+     */
+    static Entry pack(GameMove::Type type, int cardId, int mainIndex)
+    {
+        assert(cardId >= 0 && cardId <= MAX_CARD_ID);
+        assert(mainIndex >= 0 && mainIndex <= MAX_MAIN_INDEX);
+        return static_cast<Entry>(type)
+             | (static_cast<Entry>(mainIndex & MAX_MAIN_INDEX) << 2)
+             | (static_cast<Entry>(cardId & MAX_CARD_ID) << 12);
+    }
+
+    static GameMove::Type getType(Entry entry) { return static_cast<GameMove::Type>(entry & 0x3u); }
+    static int getMainIndex(Entry entry) { return static_cast<int>((entry >> 2) & MAX_MAIN_INDEX); }
+    static int getCardId(Entry entry) { return static_cast<int>(entry >> 12); }
+    static GameMove toMove(Entry entry) { return GameMove(getType(entry), getCardId(entry)); }
+
+private:
+    std::vector<Entry> _entries;    // 全部记录（含可重做部分）
+    size_t _cursor;                 // 已生效的记录数
+
+public:
+    MoveJournal() : _cursor(0) {}
+
+    // 记录新操作，丢弃可重做的记录
+    void record(Entry entry)
+    {
+        _entries.resize(_cursor);
+        _entries.push_back(entry);
+        _cursor++;
+    }
+
+    bool canUndo() const { return _cursor > 0; }
+    bool canRedo() const { return _cursor < _entries.size(); }
+
+    // 取出最近一条已生效的记录并回退游标，调用前需确认 canUndo()
+    Entry popUndo() { return _entries[--_cursor]; }
+
+    // 取出下一条可重做的记录并前移游标，调用前需确认 canRedo()
+    Entry popRedo() { return _entries[_cursor++]; }
+
+    // 已生效的记录数
+    size_t getAppliedCount() const { return _cursor; }
+
+    // 第 index 条已生效记录
+    Entry getEntry(size_t index) const { return _entries[index]; }
+
+    // 清空日志（保留容量，避免每局重新分配）
+    void clear()
+    {
+        _entries.clear();
+        _cursor = 0;
+    }
+};
+
+#endif // __MOVE_JOURNAL_H__
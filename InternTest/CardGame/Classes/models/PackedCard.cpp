@@ -0,0 +1,24 @@
+#include "PackedCard.h"
+#include <cassert>
+
+PackedCard::PackedCard(CardModel::Suit suit, CardModel::Value value, bool faceUp, int id)
+    : _bits(static_cast<uint16_t>((value & 0xF)
+                                  | ((suit & 0x3) << 4)
+                                  | (faceUp ? 0x40 : 0)
+                                  | (id << 7)))
+{
+    // 超出范围的ID无法编码，截断会与其他卡牌混淆；调用方须先检查（见 PackedGameState::fromGameModel）
+    assert(id >= 0 && id <= MAX_ID);
+}
+
+PackedCard::PackedCard(const CardModel& card)
+    : PackedCard(card.getSuit(), card.getValue(), card.isFaceUp(), card.getId())
+{
+}
+
+CardModel PackedCard::toCardModel() const
+{
+    CardModel card(getSuit(), getValue(), getId());
+    card.setFaceUp(isFaceUp());
+    return card;
+}
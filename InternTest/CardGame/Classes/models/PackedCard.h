@@ -0,0 +1,45 @@
+#ifndef __PACKED_CARD_H__
+#define __PACKED_CARD_H__
+
+#include "CardModel.h"
+#include <cstdint>
+
+/**
+ * 紧凑卡牌编码（2字节）
+ * 职责：用16位整数表示一张卡牌，供模拟器与求解器批量保存状态
+ * 位布局：[0..3]数值 [4..5]花色 [6]正面朝上 [7..15]卡牌ID
+ * 注意：层级与网格索引不在编码内，由 PackedGameState 单独保存；卡牌ID须在 [0, MAX_ID] 内，不做截断
+ */
+class PackedCard
+{
+public:
+    static const int MAX_ID = 511;      // 可编码的最大卡牌ID
+
+private:
+    uint16_t _bits;
+
+public:
+    PackedCard() : _bits(0) {}
+    PackedCard(CardModel::Suit suit, CardModel::Value value, bool faceUp, int id);
+    explicit PackedCard(const CardModel& card);
+
+    // 与 CardModel 互相转换
+    CardModel toCardModel() const;
+    static PackedCard fromBits(uint16_t bits) { PackedCard card; card._bits = bits; return card; }
+    uint16_t getBits() const { return _bits; }
+
+    // Getter方法
+    CardModel::Value getValue() const { return static_cast<CardModel::Value>(_bits & 0xF); }
+    CardModel::Suit getSuit() const { return static_cast<CardModel::Suit>((_bits >> 4) & 0x3); }
+    bool isFaceUp() const { return (_bits & 0x40) != 0; }
+    int getId() const { return _bits >> 7; }
+
+    // Setter方法
+    void setFaceUp(bool faceUp) { _bits = faceUp ? (_bits | 0x40) : (_bits & ~0x40); }
+
+    // 比较操作（与 CardModel 一致，只比较花色和数值）
+    bool operator==(const PackedCard& other) const { return (_bits & 0x3F) == (other._bits & 0x3F); }
+    bool operator!=(const PackedCard& other) const { return !(*this == other); }
+};
+
+#endif // __PACKED_CARD_H__
@@ -0,0 +1,226 @@
+#include "PackedGameState.h"
+#include "GameModel.h"
+#include "TableauLayout.h"
+#include "ZobristKeys.h"
+#include <cstring>
+
+PackedGameState::PackedGameState()
+    : _cardCount(0)
+    , _hash(0)
+    , _rankHash(0)
+    , _occupiedGrid(0)
+    , _layout(nullptr)
+{
+    std::memset(_zones, 0, sizeof(_zones));
+    std::memset(_ids, 0, sizeof(_ids));
+    std::memset(_suits, 0, sizeof(_suits));
+    std::memset(_gridIndices, 0, sizeof(_gridIndices));
+    std::memset(_counts, 0, sizeof(_counts));
+}
+
+bool PackedGameState::fromGameModel(const GameModel& gameModel, PackedGameState& outState)
+{
+    outState = PackedGameState();
+    outState._layout = &gameModel.getLayout();
+
+    const std::vector<CardModel>* stacks[ZONE_COUNT] = {
+        &gameModel.getMainCardStack(),
+        &gameModel.getBottomCardStack(),
+        &gameModel.getSpareCardStack()
+    };
+
+    // 卡牌会在区域间移动，总数不超过单区容量才能保证任何操作都不溢出
+    size_t total = stacks[MAIN]->size() + stacks[BOTTOM]->size() + stacks[SPARE]->size();
+    if (total > static_cast<size_t>(MAX_CARDS))
+    {
+        return false;
+    }
+
+    for (int zone = 0; zone < ZONE_COUNT; zone++)
+    {
+        for (const auto& card : *stacks[zone])
+        {
+            // 卡牌ID和主牌网格索引超出紧凑编码范围时拒绝转换，不截断（截断后会与其他卡牌/槽位混淆）
+            if (card.getId() < 0 || card.getId() > PackedCard::MAX_ID
+                || (zone == MAIN && (card.getGridIndex() < 0 || card.getGridIndex() > UINT8_MAX)))
+            {
+                return false;
+            }
+            if (!outState.pushCard(static_cast<Zone>(zone), PackedCard(card), card.getGridIndex()))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void PackedGameState::toGameModel(GameModel& gameModel) const
+{
+    gameModel.clearMainStack();
+    gameModel.clearBottomStack();
+    gameModel.clearSpareCard();
+
+    for (int zone = 0; zone < ZONE_COUNT; zone++)
+    {
+        for (int i = 0; i < _counts[zone]; i++)
+        {
+            CardModel card = getCard(static_cast<Zone>(zone), i).toCardModel();
+            card.setGridIndex(getGridIndex(static_cast<Zone>(zone), i));
+
+            switch (zone)
+            {
+                case MAIN: gameModel.addToMainStack(card); break;
+                case BOTTOM: gameModel.addToBottomStack(card); break;
+                default: gameModel.addToSpareStack(card); break;
+            }
+        }
+    }
+}
+
+bool PackedGameState::hasCovers() const
+{
+    return _layout && _layout->hasSlots();
+}
+
+bool PackedGameState::isMainCovered(int index) const
+{
+    return _layout && (_layout->getCoverMask(getGridIndex(MAIN, index)) & _occupiedGrid) != 0;
+}
+
+uint16_t PackedGameState::getUncoveredMainRankMask() const
+{
+    if (!hasCovers())
+    {
+        return getRankMask(MAIN);
+    }
+
+    const uint8_t* ranks = _zones[MAIN].ranks;
+    uint16_t mask = 0;
+    for (int i = 0; i < _counts[MAIN]; i++)
+    {
+        if (!isMainCovered(i))
+        {
+            mask |= static_cast<uint16_t>(1u << ranks[i]);
+        }
+    }
+    return mask;
+}
+
+PackedCard PackedGameState::getCard(Zone zone, int index) const
+{
+    int card = _zones[zone].cards[index];
+    return PackedCard(static_cast<CardModel::Suit>(_suits[card]),
+                      static_cast<CardModel::Value>(_zones[zone].ranks[index]),
+                      zone != SPARE,
+                      _ids[card]);
+}
+
+bool PackedGameState::pushCard(Zone zone, const PackedCard& card, int gridIndex)
+{
+    // 每个区域的卡牌都来自卡牌表，表未满时区域也不会满
+    if (_cardCount >= MAX_CARDS)
+    {
+        return false;
+    }
+
+    int slot = _cardCount++;
+    _ids[slot] = static_cast<uint16_t>(card.getId());
+    _suits[slot] = static_cast<uint8_t>(card.getSuit());
+    _gridIndices[slot] = static_cast<uint8_t>(gridIndex);
+
+    Lanes& lanes = _zones[zone];
+    int index = _counts[zone]++;
+    lanes.ranks[index] = static_cast<uint8_t>(card.getValue());
+    lanes.cards[index] = static_cast<uint8_t>(slot);
+    enterZone(zone, index);
+    if (zone == MAIN)
+    {
+        _occupiedGrid |= getGridBit(index);
+    }
+    return true;
+}
+
+void PackedGameState::moveMainToBottom(int index)
+{
+    // 主牌移到底牌栈顶，末尾主牌填补空位（主牌键按网格索引计算，填补不影响哈希）
+    int last = _counts[MAIN] - 1;
+    int top = _counts[BOTTOM]++;
+    leaveZone(MAIN, index);
+    _occupiedGrid &= ~getGridBit(index);
+    copyCard(MAIN, index, BOTTOM, top);
+    enterZone(BOTTOM, top);
+    if (index != last)
+    {
+        copyCard(MAIN, last, MAIN, index);
+    }
+    _counts[MAIN]--;
+}
+
+void PackedGameState::undoMoveMainToBottom(int index)
+{
+    // 被填补到index的主牌放回末尾，再把底牌栈顶放回index
+    int last = _counts[MAIN]++;
+    int top = --_counts[BOTTOM];
+    if (index != last)
+    {
+        copyCard(MAIN, index, MAIN, last);
+    }
+    leaveZone(BOTTOM, top);
+    copyCard(BOTTOM, top, MAIN, index);
+    enterZone(MAIN, index);
+    _occupiedGrid |= getGridBit(index);
+}
+
+void PackedGameState::moveSpareToBottom()
+{
+    if (_counts[SPARE] > 0)
+    {
+        int from = --_counts[SPARE];
+        int to = _counts[BOTTOM]++;
+        leaveZone(SPARE, from);
+        copyCard(SPARE, from, BOTTOM, to);
+        enterZone(BOTTOM, to);
+    }
+}
+
+void PackedGameState::moveBottomToSpare()
+{
+    if (_counts[BOTTOM] > 0)
+    {
+        int from = --_counts[BOTTOM];
+        int to = _counts[SPARE]++;
+        leaveZone(BOTTOM, from);
+        copyCard(BOTTOM, from, SPARE, to);
+        enterZone(SPARE, to);
+    }
+}
+
+void PackedGameState::copyCard(Zone fromZone, int fromIndex, Zone toZone, int toIndex)
+{
+    const Lanes& from = _zones[fromZone];
+    Lanes& to = _zones[toZone];
+    to.ranks[toIndex] = from.ranks[fromIndex];
+    to.cards[toIndex] = from.cards[fromIndex];
+}
+
+void PackedGameState::enterZone(Zone zone, int index)
+{
+    toggleKeys(zone, index);
+    _rankIndices[zone].add(_zones[zone].ranks[index]);
+}
+
+void PackedGameState::leaveZone(Zone zone, int index)
+{
+    toggleKeys(zone, index);
+    _rankIndices[zone].remove(_zones[zone].ranks[index]);
+}
+
+void PackedGameState::toggleKeys(Zone zone, int index)
+{
+    const Lanes& lanes = _zones[zone];
+    int card = lanes.cards[index];
+    int position = (zone == MAIN) ? _gridIndices[card] : index;
+    _hash ^= ZobristKeys::getCardKey(zone, position, _suits[card], lanes.ranks[index]);
+    _rankHash ^= ZobristKeys::getRankKey(zone, position, lanes.ranks[index]);
+}
@@ -0,0 +1,136 @@
+#ifndef __PACKED_GAME_STATE_H__
+#define __PACKED_GAME_STATE_H__
+
+#include "PackedCard.h"
+#include "RankIndex.h"
+#include <cstdint>
+
+class GameModel;
+class TableauLayout;
+
+/**
+ * 紧凑游戏状态（结构数组布局）
+ * 职责：以定长数组按字段分列保存三个区域的卡牌，不做堆分配，
+ *       供模拟器和求解器大量保存、复制和回溯游戏状态
+ * 布局：花色、网格索引、卡牌ID不随移动变化，存放在全部区域共用的卡牌表中；
+ *       每个区域只保存数值列（供并行比较）和卡牌表下标列，移动一张牌只复制两个字节
+ * 注意：正反面由区域决定（主牌区、底牌区朝上，备用区朝下），不单独保存
+ * 覆盖：以网格索引为位序维护主牌区占用掩码，与布局的覆盖掩码相与即可判断主牌是否被覆盖
+ */
+class PackedGameState
+{
+public:
+    static const int MAX_CARDS = 52;        // 卡牌总数上限（一副牌），也是卡牌表和每个区域的容量
+    static const int RANK_LANE_SIZE = 64;   // 数值列按16字节一组并行比较，补齐到16的倍数
+
+    // 区域
+    enum Zone {
+        MAIN = 0,       // 主牌区（无序，移除时与末尾交换）
+        BOTTOM,         // 底牌区（栈顶用于匹配）
+        SPARE,          // 备用区
+        ZONE_COUNT
+    };
+
+private:
+    // 单个区域的字段列
+    struct Lanes
+    {
+        alignas(16) uint8_t ranks[RANK_LANE_SIZE];  // 数值（1-13），补齐部分恒为0
+        uint8_t cards[MAX_CARDS];                   // 卡牌表下标
+    };
+
+    Lanes _zones[ZONE_COUNT];
+    uint16_t _ids[MAX_CARDS];                   // 卡牌表：卡牌ID
+    uint8_t _suits[MAX_CARDS];                  // 卡牌表：花色
+    uint8_t _gridIndices[MAX_CARDS];            // 卡牌表：主牌网格索引
+    uint8_t _cardCount;                         // 卡牌表已用条数
+    uint8_t _counts[ZONE_COUNT];
+    RankIndex _rankIndices[ZONE_COUNT];     // 各区域数值索引，随每次移动增量更新
+    uint64_t _hash;                 // Zobrist哈希，随每次移动增量更新
+    uint64_t _rankHash;             // 忽略花色的规范哈希，同样增量更新
+    uint64_t _occupiedGrid;         // 主牌区占用的网格槽位
+    const TableauLayout* _layout;   // 主牌区牌阵布局，nullptr 表示互不覆盖
+
+public:
+    PackedGameState();
+
+    /**
+     * 从游戏模型构建紧凑状态
+     * @param gameModel 游戏数据模型
+     * @param outState 输出状态
+     * @return 卡牌总数超出单个区域容量、卡牌ID超出 PackedCard::MAX_ID 或主牌网格索引超出 [0, 255] 时返回false
+     */
+    static bool fromGameModel(const GameModel& gameModel, PackedGameState& outState);
+
+    /**
+     * 将卡牌写回游戏模型（替换三个区域的全部卡牌）
+     * @param gameModel 游戏数据模型
+     */
+    void toGameModel(GameModel& gameModel) const;
+
+    // 查询
+    int getCount(Zone zone) const { return _counts[zone]; }
+    bool isEmpty(Zone zone) const { return _counts[zone] == 0; }
+    int getRank(Zone zone, int index) const { return _zones[zone].ranks[index]; }
+    int getId(Zone zone, int index) const { return _ids[_zones[zone].cards[index]]; }
+    int getGridIndex(Zone zone, int index) const { return _gridIndices[_zones[zone].cards[index]]; }
+    PackedCard getCard(Zone zone, int index) const;
+    const uint8_t* getRankLane(Zone zone) const { return _zones[zone].ranks; }
+
+    // 某区域全部卡牌的数值掩码（见 RankIndex）
+    uint16_t getRankMask(Zone zone) const { return _rankIndices[zone].getMask(); }
+
+    // 状态哈希（见 ZobristKeys）
+    uint64_t getHash() const { return _hash; }
+
+    // 规范哈希：只按数值取键，仅花色不同的局面可解性相同，求解器的置换表使用它
+    uint64_t getCanonicalHash() const { return _rankHash; }
+
+    // 牌阵布局（fromGameModel 时取自模型）
+    void setLayout(const TableauLayout* layout) { _layout = layout; }
+    const TableauLayout* getLayout() const { return _layout; }
+
+    // 布局中是否存在覆盖关系
+    bool hasCovers() const;
+
+    // 主牌区某下标上的卡牌是否被覆盖
+    bool isMainCovered(int index) const;
+
+    // 主牌区未被覆盖的卡牌的数值掩码（只有它们能被打出）；没有覆盖关系时即主牌区的数值掩码
+    uint16_t getUncoveredMainRankMask() const;
+
+    // 底牌区栈顶数值，底牌区为空时返回0
+    int getTopBottomRank() const { return _counts[BOTTOM] ? _zones[BOTTOM].ranks[_counts[BOTTOM] - 1] : 0; }
+
+    // 在某区域末尾加入卡牌，返回是否成功（卡牌总数超出 MAX_CARDS 时失败）
+    bool pushCard(Zone zone, const PackedCard& card, int gridIndex);
+
+    // 操作（与 GameModel 对应的三种移动）
+    void moveMainToBottom(int index);       // 主牌（下标index）移到底牌区
+    void moveSpareToBottom();               // 备用牌移到底牌区
+    void moveBottomToSpare();               // 底牌移到备用区
+
+    // 精确撤销 moveMainToBottom，主牌区恢复原有顺序
+    void undoMoveMainToBottom(int index);
+
+private:
+    void copyCard(Zone fromZone, int fromIndex, Zone toZone, int toIndex);
+
+    // 某区域某下标上的卡牌进入/离开该区域：异或两个哈希并更新数值索引
+    void enterZone(Zone zone, int index);
+    void leaveZone(Zone zone, int index);
+    void toggleKeys(Zone zone, int index);
+
+    // 主牌区某下标上卡牌的网格占用位
+    uint64_t getGridBit(int index) const
+    {
+        int gridIndex = getGridIndex(MAIN, index);
+        return gridIndex < 64 ? 1ull << gridIndex : 0;
+    }
+};
+
+// 每份状态约 0.7 KB：三个区域各 128 字节（数值列 64 + 下标列 52，按16字节对齐），卡牌表 208 字节，
+// 三个数值索引 48 字节，其余为计数、哈希、占用掩码和布局指针；求解器和提示线程按值复制状态，增长时需重新评估
+static_assert(sizeof(PackedGameState) <= 704, "PackedGameState should fit in 11 cache lines");
+
+#endif // __PACKED_GAME_STATE_H__
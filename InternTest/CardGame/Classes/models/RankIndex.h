@@ -0,0 +1,69 @@
+#ifndef __RANK_INDEX_H__
+#define __RANK_INDEX_H__
+
+#include <cstdint>
+#include <cstring>
+
+/**
+ * 数值索引
+ * 职责：按数值（1-13）统计一组卡牌的张数，并维护“存在该数值”的位掩码（第 rank 位），
+ *       卡牌进出时 O(1) 增量更新，供 GameModel、PackedGameState 判断可匹配数值
+ * 使用场景：结合 getNeighbours 可一次位运算求出与某组数值相邻（可匹配）的数值集合
+ */
+class RankIndex
+{
+public:
+    static const int RANK_COUNT = 14;               // 下标 0 不使用
+    static const uint16_t FULL_RANK_MASK = 0x3FFE;  // 数值 1-13 对应的位
+
+    RankIndex() { clear(); }
+
+    void clear()
+    {
+        _mask = 0;
+        std::memset(_counts, 0, sizeof(_counts));
+    }
+
+    /**
+     * 加入一张卡牌
+     * @param rank 卡牌数值，超出 [1, 13] 时忽略
+     */
+    void add(int rank)
+    {
+        if (rank > 0 && rank < RANK_COUNT && _counts[rank]++ == 0)
+        {
+            _mask |= static_cast<uint16_t>(1u << rank);
+        }
+    }
+
+    /**
+     * 移除一张卡牌
+     * @param rank 卡牌数值，超出 [1, 13] 或张数已为0时忽略
+     */
+    void remove(int rank)
+    {
+        if (rank > 0 && rank < RANK_COUNT && _counts[rank] > 0 && --_counts[rank] == 0)
+        {
+            _mask &= static_cast<uint16_t>(~(1u << rank));
+        }
+    }
+
+    uint16_t getMask() const { return _mask; }
+    int getCount(int rank) const { return (rank > 0 && rank < RANK_COUNT) ? _counts[rank] : 0; }
+
+    /**
+     * 与一组数值相邻（相差1）的数值掩码
+     * @param rankMask 数值掩码
+     * @return 相邻数值掩码，只保留 1-13
+     */
+    static uint16_t getNeighbours(uint16_t rankMask)
+    {
+        return static_cast<uint16_t>(((rankMask << 1) | (rankMask >> 1)) & FULL_RANK_MASK);
+    }
+
+private:
+    uint16_t _mask;                 // 张数大于0的数值
+    uint8_t _counts[RANK_COUNT];    // 各数值张数
+};
+
+#endif // __RANK_INDEX_H__
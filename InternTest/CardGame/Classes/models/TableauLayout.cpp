@@ -0,0 +1,111 @@
+#include "TableauLayout.h"
+#include <algorithm>
+#include <cstdlib>
+
+const TableauLayout& TableauLayout::getLayout(Kind kind)
+{
+    // 局部静态对象：首次使用时构建，初始化线程安全
+    static const TableauLayout s_flat(FLAT);
+    static const TableauLayout s_triPeaks(TRI_PEAKS);
+    static const TableauLayout s_pyramid(PYRAMID);
+
+    switch (kind)
+    {
+        case TRI_PEAKS: return s_triPeaks;
+        case PYRAMID: return s_pyramid;
+        default: return s_flat;
+    }
+}
+
+TableauLayout::TableauLayout(Kind kind)
+    : _kind(kind)
+    , _width(0)
+    , _height(0)
+{
+    switch (kind)
+    {
+        case TRI_PEAKS:
+            // 三座峰顶各一张，往下每层每峰两张，最后两层连成一排
+            addPeakRow(0, 0, 3, 1, 6);
+            addPeakRow(1, 1, 2, 2, 6);
+            addRow(2, 2, 1, 9);
+            addRow(3, 3, 0, 10);
+            break;
+        case PYRAMID:
+            for (int row = 0; row < 7; row++)
+            {
+                addRow(row, row, 6 - row, row + 1);
+            }
+            break;
+        default:
+            break;
+    }
+    buildCoverGraph();
+}
+
+void TableauLayout::addRow(int layer, int y, int x, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        Slot slot = { layer, x + i * 2, y };
+        _slots.push_back(slot);
+    }
+}
+
+void TableauLayout::addPeakRow(int layer, int y, int x, int perPeak, int peakStride)
+{
+    for (int peak = 0; peak < 3; peak++)
+    {
+        addRow(layer, y, x + peak * peakStride, perPeak);
+    }
+}
+
+void TableauLayout::buildCoverGraph()
+{
+    int count = static_cast<int>(_slots.size());
+    _coveredOffsets.assign(count + 1, 0);
+    _coverMasks.assign(count, 0);
+
+    // 层级更高且两张牌的矩形相交（横纵坐标都相差不到一张牌）即为覆盖
+    for (int upper = 0; upper < count; upper++)
+    {
+        const Slot& a = _slots[upper];
+        _coveredOffsets[upper] = static_cast<int>(_coveredSlots.size());
+        for (int lower = 0; lower < count; lower++)
+        {
+            const Slot& b = _slots[lower];
+            if (a.layer > b.layer && std::abs(a.x - b.x) < 2 && std::abs(a.y - b.y) < 2)
+            {
+                _coveredSlots.push_back(lower);
+                _coverMasks[lower] |= 1ull << upper;
+            }
+        }
+        _width = std::max(_width, a.x + 2);
+        _height = std::max(_height, a.y + 2);
+    }
+    _coveredOffsets[count] = static_cast<int>(_coveredSlots.size());
+}
+
+TableauLayout::SlotRange TableauLayout::getCoveredSlots(int slot) const
+{
+    SlotRange range = { nullptr, nullptr };
+    if (slot >= 0 && slot < static_cast<int>(_slots.size()))
+    {
+        const int* base = _coveredSlots.data();
+        range.first = base + _coveredOffsets[slot];
+        range.last = base + _coveredOffsets[slot + 1];
+    }
+    return range;
+}
+
+int TableauLayout::getCovererCount(int slot) const
+{
+    uint64_t mask = getCoverMask(slot);
+    int count = 0;
+    while (mask)
+    {
+        mask &= mask - 1;
+        count++;
+    }
+    return count;
+}
@@ -0,0 +1,102 @@
+#ifndef __TABLEAU_LAYOUT_H__
+#define __TABLEAU_LAYOUT_H__
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * 主牌区牌阵布局
+ * 职责：定义主牌区各网格槽位的层级与位置，并预先计算槽位之间的覆盖关系（有向无环图）
+ * 覆盖：层级更高且与之重叠的槽位覆盖它；只有覆盖它的槽位全部清空后，该槽位上的卡牌才可点击
+ * 约定：槽位按层级从低到高编号，网格索引即槽位下标，显示层级随网格索引递增；
+ *       没有槽位定义的布局（平铺）任何网格索引都不被覆盖
+ * 布局实例不可变，由 getLayout 统一提供，可在线程间共享
+ */
+class TableauLayout
+{
+public:
+    static const int MAX_SLOTS = 64;    // 槽位上限（覆盖掩码为64位）
+
+    // 内置布局
+    enum Kind {
+        FLAT = 0,       // 平铺网格，互不覆盖
+        TRI_PEAKS,      // 三峰（4层28张）
+        PYRAMID         // 金字塔（7层28张）
+    };
+
+    // 槽位：坐标以半张牌为单位，y向下递增
+    struct Slot
+    {
+        int layer;
+        int x;
+        int y;
+    };
+
+    // 被某槽位直接覆盖的槽位列表
+    struct SlotRange
+    {
+        const int* first;
+        const int* last;
+
+        const int* begin() const { return first; }
+        const int* end() const { return last; }
+    };
+
+private:
+    Kind _kind;
+    std::vector<Slot> _slots;
+    std::vector<int> _coveredOffsets;       // 槽位 -> 在 _coveredSlots 中的起始位置（共 slots+1 项）
+    std::vector<int> _coveredSlots;         // 各槽位直接覆盖的槽位，按槽位连续存放
+    std::vector<uint64_t> _coverMasks;      // 槽位 -> 直接覆盖它的槽位掩码
+    int _width;                             // 牌阵宽度（半张牌）
+    int _height;                            // 牌阵高度（半张牌）
+
+public:
+    /**
+     * 获取内置布局
+     * @param kind 布局类型
+     * @return 布局实例（程序生命周期内有效）
+     */
+    static const TableauLayout& getLayout(Kind kind);
+
+    Kind getKind() const { return _kind; }
+    int getSlotCount() const { return static_cast<int>(_slots.size()); }
+    bool hasSlots() const { return !_slots.empty(); }
+    const Slot& getSlot(int slot) const { return _slots[slot]; }
+    int getWidth() const { return _width; }
+    int getHeight() const { return _height; }
+
+    /**
+     * 获取被某槽位直接覆盖的槽位
+     * @param slot 网格索引，超出槽位范围时返回空列表
+     * @return 槽位列表
+     */
+    SlotRange getCoveredSlots(int slot) const;
+
+    /**
+     * 获取直接覆盖某槽位的槽位掩码，与主牌区占用掩码相与即可判断是否被覆盖
+     * @param slot 网格索引，超出槽位范围时返回0
+     * @return 槽位掩码
+     */
+    uint64_t getCoverMask(int slot) const
+    {
+        return slot >= 0 && slot < static_cast<int>(_coverMasks.size()) ? _coverMasks[slot] : 0;
+    }
+
+    // 直接覆盖某槽位的槽位数
+    int getCovererCount(int slot) const;
+
+private:
+    explicit TableauLayout(Kind kind);
+
+    // 加入一行槽位：从x开始每隔一张牌放一个
+    void addRow(int layer, int y, int x, int count);
+
+    // 加入三峰中的一行：每座峰上放 perPeak 张牌
+    void addPeakRow(int layer, int y, int x, int perPeak, int peakStride);
+
+    // 按槽位的重叠关系建立覆盖图
+    void buildCoverGraph();
+};
+
+#endif // __TABLEAU_LAYOUT_H__
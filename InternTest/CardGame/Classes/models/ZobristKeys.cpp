@@ -0,0 +1,86 @@
+#include "ZobristKeys.h"
+
+namespace
+{
+    // splitmix64 的输出混合函数（双射：不同输入得到不同输出）
+    uint64_t mix(uint64_t z)
+    {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // 表外位置的键：由区域、位置和卡牌编号直接混合得到，与表内键来自不同的输入，不会因取模而重复
+    uint64_t getOverflowKey(int zone, int position, int card)
+    {
+        const uint64_t OVERFLOW_SEED = 0xD1B54A32D192ED03ull;
+        uint64_t input = (static_cast<uint64_t>(zone) << 48)
+                         | (static_cast<uint64_t>(static_cast<uint32_t>(position)) << 8)
+                         | static_cast<uint64_t>(card);
+        return mix(OVERFLOW_SEED ^ input);
+    }
+
+    struct KeyTable
+    {
+        uint64_t keys[ZobristKeys::ZONE_COUNT][ZobristKeys::POSITION_COUNT][ZobristKeys::CARD_COUNT];
+        uint64_t rankKeys[ZobristKeys::ZONE_COUNT][ZobristKeys::POSITION_COUNT][ZobristKeys::RANK_COUNT];
+
+        KeyTable()
+        {
+            // 固定种子的 splitmix64 序列，保证不同进程、不同平台生成相同的键；规范键接在卡牌键之后生成
+            uint64_t state = 0x9E3779B97F4A7C15ull;
+            for (int zone = 0; zone < ZobristKeys::ZONE_COUNT; zone++)
+            {
+                for (int position = 0; position < ZobristKeys::POSITION_COUNT; position++)
+                {
+                    for (int card = 0; card < ZobristKeys::CARD_COUNT; card++)
+                    {
+                        keys[zone][position][card] = next(state);
+                    }
+                }
+            }
+            for (int zone = 0; zone < ZobristKeys::ZONE_COUNT; zone++)
+            {
+                for (int position = 0; position < ZobristKeys::POSITION_COUNT; position++)
+                {
+                    for (int rank = 0; rank < ZobristKeys::RANK_COUNT; rank++)
+                    {
+                        rankKeys[zone][position][rank] = next(state);
+                    }
+                }
+            }
+        }
+
+        static uint64_t next(uint64_t& state)
+        {
+            state += 0x9E3779B97F4A7C15ull;
+            return mix(state);
+        }
+    };
+
+    const KeyTable& getKeyTable()
+    {
+        static const KeyTable table;
+        return table;
+    }
+}
+
+uint64_t ZobristKeys::getCardKey(int zone, int position, int suit, int rank)
+{
+    int card = suit * RANK_COUNT + (rank - 1);
+    if (position < 0 || position >= POSITION_COUNT)
+    {
+        return getOverflowKey(zone, position, card);
+    }
+    return getKeyTable().keys[zone][position][card];
+}
+
+uint64_t ZobristKeys::getRankKey(int zone, int position, int rank)
+{
+    if (position < 0 || position >= POSITION_COUNT)
+    {
+        // 规范键的编号排在卡牌编号之后，与卡牌键不重叠
+        return getOverflowKey(zone, position, CARD_COUNT + (rank - 1));
+    }
+    return getKeyTable().rankKeys[zone][position][rank - 1];
+}
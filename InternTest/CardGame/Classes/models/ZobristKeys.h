@@ -0,0 +1,46 @@
+#ifndef __ZOBRIST_KEYS_H__
+#define __ZOBRIST_KEYS_H__
+
+#include <cstdint>
+
+/**
+ * Zobrist随机键表
+ * 职责：为"某张牌位于某区域某位置"提供固定的64位随机键，
+ *       状态哈希为所有卡牌键的异或，移动一张牌只需两次异或即可增量更新
+ * 位置约定：主牌区使用网格索引（与栈内顺序无关），底牌区/备用区使用栈内下标
+ * 位置范围：[0, POSITION_COUNT) 查表；其余位置（更深的牌堆、更大的网格）按区域/位置/卡牌直接混合生成，
+ *           不对位置取模，不同位置上的同一张牌不会得到相同的键
+ * 规范键：匹配规则与花色无关，只按数值取键，花色不同而数值相同的局面得到同一哈希
+ */
+class ZobristKeys
+{
+public:
+    static const int ZONE_COUNT = 3;        // 主牌区、底牌区、备用区
+    static const int POSITION_COUNT = 64;   // 每个区域预先生成键的位置数
+    static const int CARD_COUNT = 52;       // 花色 × 数值
+    static const int RANK_COUNT = 13;       // 数值
+
+    /**
+     * 获取卡牌键
+     * @param zone 区域（与 PackedGameState::Zone 一致）
+     * @param position 位置
+     * @param suit 花色
+     * @param rank 数值（1-13）
+     * @return 64位随机键
+     */
+    static uint64_t getCardKey(int zone, int position, int suit, int rank);
+
+    /**
+     * 获取忽略花色的规范键
+     * @param zone 区域（与 PackedGameState::Zone 一致）
+     * @param position 位置
+     * @param rank 数值（1-13）
+     * @return 64位随机键
+     */
+    static uint64_t getRankKey(int zone, int position, int rank);
+
+private:
+    ZobristKeys() = delete;  // 禁止实例化
+};
+
+#endif // __ZOBRIST_KEYS_H__
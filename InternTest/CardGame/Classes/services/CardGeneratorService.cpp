@@ -1,14 +1,17 @@
 #include "CardGeneratorService.h"
-#include "../configs/GameConfig.h"
 #include <algorithm>
-#include <random>
-#include <chrono>
+#include <utility>
 
-// 
+//
 CardModel CardGeneratorService::generateRandomCard(int id)
 {
-    CardModel::Suit suit = generateRandomSuit();
-    CardModel::Value value = generateRandomValue();
+    return generateRandomCard(getThreadGenerator(), id);
+}
+
+CardModel CardGeneratorService::generateRandomCard(RandomGenerator& rng, int id)
+{
+    CardModel::Suit suit = generateRandomSuit(rng);
+    CardModel::Value value = generateRandomValue(rng);
     return CardModel(suit, value, id);
 }
 
@@ -16,43 +19,89 @@ std::vector<CardModel> CardGeneratorService::generateRandomCards(int count, int
 {
     std::vector<CardModel> cards;
     cards.reserve(count);
-    
+
     for (int i = 0; i < count; i++)
     {
         cards.push_back(generateRandomCard(startId + i));
     }
-    
+
     return cards;
 }
 
 void CardGeneratorService::generateInitialCards(GameModel& gameModel, int mainCardCount, int bottomCardCount, int spareCardCount)
 {
+    generateInitialCards(gameModel, getThreadGenerator().nextUInt64(), mainCardCount, bottomCardCount, spareCardCount);
+}
+
+void CardGeneratorService::generateInitialCards(GameModel& gameModel, uint64_t seed, int mainCardCount, int bottomCardCount,
+                                                int spareCardCount)
+{
+    RandomGenerator rng(seed);
+    gameModel.setSeed(seed);
+
+    // 有槽位定义的牌阵最多发满全部槽位，网格索引即槽位
+    const TableauLayout& layout = gameModel.getLayout();
+    if (layout.hasSlots())
+    {
+        mainCardCount = std::min(mainCardCount, layout.getSlotCount());
+    }
+
     // 生成初始底牌区（缺省：1张卡牌）
-    addRandomCardbyNumAndWhere(bottomCardCount, _Bottom, gameModel);
+    addRandomCardbyNumAndWhere(bottomCardCount, _Bottom, gameModel, rng);
     // 生成初始备用牌区（缺省：2张卡牌）
-    addRandomCardbyNumAndWhere(spareCardCount, _Spare, gameModel);
+    addRandomCardbyNumAndWhere(spareCardCount, _Spare, gameModel, rng);
     // 生成主牌区 （缺省：9张卡牌）
-    addRandomCardbyNumAndWhere(mainCardCount, _Main, gameModel);
+    addRandomCardbyNumAndWhere(mainCardCount, _Main, gameModel, rng);
+}
+
+bool CardGeneratorService::generateWinnableCards(GameModel& gameModel, int mainCardCount, int bottomCardCount, int spareCardCount,
+                                                 int maxAttempts, const SolverService::Limits& limits)
+{
+    return generateWinnableCards(gameModel, getThreadGenerator().nextUInt64(), mainCardCount, bottomCardCount,
+                                 spareCardCount, maxAttempts, limits);
+}
+
+bool CardGeneratorService::generateWinnableCards(GameModel& gameModel, uint64_t seed, int mainCardCount, int bottomCardCount,
+                                                 int spareCardCount, int maxAttempts, const SolverService::Limits& limits)
+{
+    for (int attempt = 0; attempt < maxAttempts; attempt++)
+    {
+        gameModel.reset();
+        generateInitialCards(gameModel, RandomGenerator::deriveSeed(seed, attempt),
+                             mainCardCount, bottomCardCount, spareCardCount);
+
+        if (SolverService::solve(gameModel, limits).status == SolverService::Result::WINNABLE)
+        {
+            return true;
+        }
+    }
+    return false;
 }
 
 // 指定添加牌的数量和位置
 void CardGeneratorService::addRandomCardbyNumAndWhere(int num, int where, GameModel& gameModel)
+{
+    addRandomCardbyNumAndWhere(num, where, gameModel, getThreadGenerator());
+}
+
+void CardGeneratorService::addRandomCardbyNumAndWhere(int num, int where, GameModel& gameModel, RandomGenerator& rng)
 {
     if (where == 1) {
         for (int i = 0; i < num; i++) {
-            CardModel card = generateRandomCard(gameModel.getNextCardId());
+            CardModel card = generateRandomCard(rng, gameModel.getNextCardId());
             gameModel.addToBottomStack(card);
         }
     } else if (where == 2) {
         for (int i = 0; i < num; i++) {
-            CardModel card = generateRandomCard(gameModel.getNextCardId());
+            CardModel card = generateRandomCard(rng, gameModel.getNextCardId());
             gameModel.addToSpareStack(card);
         }
     }else {
         for (int i = 0; i < num; i++) {
-        CardModel card = generateRandomCard(gameModel.getNextCardId());
+        CardModel card = generateRandomCard(rng, gameModel.getNextCardId());
+        card.setGridIndex(gameModel.getMainCardCount());  // 网格位置按发牌顺序
         gameModel.addToMainStack(card);
-        }    
+        }
     }
 }
 
@@ -64,27 +113,32 @@ CardModel CardGeneratorService::generateCard(CardModel::Suit suit, CardModel::Va
 
 void CardGeneratorService::shuffleCards(std::vector<CardModel>& cards)
 {
-    // 使用当前时间作为随机种子
-    unsigned seed = std::chrono::system_clock::now().time_since_epoch().count();
-    std::default_random_engine generator(seed);
-    
-    std::shuffle(cards.begin(), cards.end(), generator);
+    shuffleCards(cards, getThreadGenerator());
+}
+
+void CardGeneratorService::shuffleCards(std::vector<CardModel>& cards, RandomGenerator& rng)
+{
+    // Fisher-Yates：不使用 std::shuffle，其内部分布由标准库实现决定，跨平台结果不一致
+    for (size_t i = cards.size(); i > 1; i--)
+    {
+        size_t j = rng.nextBounded(static_cast<uint32_t>(i));
+        std::swap(cards[i - 1], cards[j]);
+    }
+}
+
+CardModel::Suit CardGeneratorService::generateRandomSuit(RandomGenerator& rng)
+{
+    return static_cast<CardModel::Suit>(rng.nextBounded(4));
 }
 
-CardModel::Suit CardGeneratorService::generateRandomSuit()
+CardModel::Value CardGeneratorService::generateRandomValue(RandomGenerator& rng)
 {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    static std::uniform_int_distribution<> dis(0, 3);
-    
-    return static_cast<CardModel::Suit>(dis(gen));
+    return static_cast<CardModel::Value>(rng.nextInt(CardModel::ACE, CardModel::KING));
 }
 
-CardModel::Value CardGeneratorService::generateRandomValue()
+RandomGenerator& CardGeneratorService::getThreadGenerator()
 {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    static std::uniform_int_distribution<> dis(1, 13);
-    
-    return static_cast<CardModel::Value>(dis(gen));
+    // 每个线程独立的随机引擎，批量分析时各工作线程可以并发发牌
+    static thread_local RandomGenerator generator(RandomGenerator::generateSeed());
+    return generator;
 }
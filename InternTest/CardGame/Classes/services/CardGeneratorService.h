@@ -3,12 +3,15 @@
 
 #include "../models/CardModel.h"
 #include "../models/GameModel.h"
+#include "SolverService.h"
+#include "../utils/RandomGenerator.h"
 #include <vector>
-#include <random>
 
 /**
  * 卡牌生成服务
  * 职责：提供卡牌生成相关的无状态服务
+ * 约定：传入种子的接口结果可复现——同一种子总是生成同一副牌局，种子记录在 GameModel 中；
+ *       不带种子的接口使用线程独立的随机序列
  */
 class CardGeneratorService
 {
@@ -19,6 +22,14 @@ public:
      * @return 随机生成的卡牌
      */
     static CardModel generateRandomCard(int id = 0);
+
+    /**
+     * 使用指定随机数生成器生成随机卡牌
+     * @param rng 随机数生成器
+     * @param id 卡牌ID
+     * @return 随机生成的卡牌
+     */
+    static CardModel generateRandomCard(RandomGenerator& rng, int id);
     
     /**
      * 生成指定数量的随机卡牌
@@ -34,15 +45,55 @@ public:
      * @param mainCardCount 主牌区卡牌数量
      * @param bottomCardCount 底牌区卡牌数量
      * @param spareCardCount 备用牌区卡牌数量
-      
      */
     static void generateInitialCards(GameModel& gameModel, int mainCardCount, int bottomCardCount, int spareCardCount);
+
+    /**
+     * 按种子为游戏模型生成初始卡牌，种子同时写入模型，可用于复现牌局
+     * @param gameModel 游戏数据模型（牌阵布局须已设置）
+     * @param seed 牌局种子
+     * @param mainCardCount 主牌区卡牌数量，不超过布局的槽位数
+     * @param bottomCardCount 底牌区卡牌数量
+     * @param spareCardCount 备用牌区卡牌数量
+     */
+    static void generateInitialCards(GameModel& gameModel, uint64_t seed, int mainCardCount, int bottomCardCount,
+                                     int spareCardCount);
     
+    /**
+     * 为游戏模型生成可解的初始卡牌（不可解时重新发牌）
+     * @param gameModel 游戏数据模型（每次尝试前会被重置）
+     * @param mainCardCount 主牌区卡牌数量
+     * @param bottomCardCount 底牌区卡牌数量
+     * @param spareCardCount 备用牌区卡牌数量
+     * @param maxAttempts 最大发牌次数
+     * @param limits 每次可解性判定的搜索限制，超出限制的牌局视为不可解
+     * @return 是否得到可解牌局；全部失败时模型中保留最后一次发牌
+     */
+    static bool generateWinnableCards(GameModel& gameModel, int mainCardCount, int bottomCardCount, int spareCardCount,
+                                      int maxAttempts, const SolverService::Limits& limits = SolverService::Limits());
+
+    /**
+     * 按种子生成可解的初始卡牌：每次尝试的牌局种子由 seed 派生，
+     * 模型中记录的是最终牌局的种子，用 generateInitialCards 即可直接复现
+     * @param gameModel 游戏数据模型（每次尝试前会被重置）
+     * @param seed 基础种子
+     * @param mainCardCount 主牌区卡牌数量
+     * @param bottomCardCount 底牌区卡牌数量
+     * @param spareCardCount 备用牌区卡牌数量
+     * @param maxAttempts 最大发牌次数
+     * @param limits 每次可解性判定的搜索限制
+     * @return 是否得到可解牌局
+     */
+    static bool generateWinnableCards(GameModel& gameModel, uint64_t seed, int mainCardCount, int bottomCardCount,
+                                      int spareCardCount, int maxAttempts,
+                                      const SolverService::Limits& limits = SolverService::Limits());
+
     /**
      * 添加一张随机主牌到主牌栈（统一栈式接口）
      * @param gameModel 游戏数据模型
      */
     static void addRandomCardbyNumAndWhere(int num, int where, GameModel& gameModel);
+    static void addRandomCardbyNumAndWhere(int num, int where, GameModel& gameModel, RandomGenerator& rng);
 
     /**
      * 生成指定花色和数值的卡牌
@@ -59,6 +110,13 @@ public:
      */
     static void shuffleCards(std::vector<CardModel>& cards);
 
+    /**
+     * 使用指定随机数生成器洗牌（Fisher-Yates），结果可复现
+     * @param cards 要洗的卡牌列表
+     * @param rng 随机数生成器
+     */
+    static void shuffleCards(std::vector<CardModel>& cards, RandomGenerator& rng);
+
 private:
     CardGeneratorService() = delete;  // 禁止实例化
     
@@ -67,15 +125,20 @@ private:
     static const int _Main = 3;
     /**
      * 生成随机花色
+     * @param rng 随机数生成器
      * @return 随机花色
      */
-    static CardModel::Suit generateRandomSuit();
+    static CardModel::Suit generateRandomSuit(RandomGenerator& rng);
     
     /**
      * 生成随机数值
+     * @param rng 随机数生成器
      * @return 随机数值
      */
-    static CardModel::Value generateRandomValue();
+    static CardModel::Value generateRandomValue(RandomGenerator& rng);
+
+    // 当前线程的随机数生成器（首次使用时以不可预测的种子初始化）
+    static RandomGenerator& getThreadGenerator();
 };
 
 #endif // __CARD_GENERATOR_SERVICE_H__
@@ -1,5 +1,5 @@
 #include "GameLogicService.h"
-#include "../configs/GameConfig.h"
+#include <cstdlib>
 
 bool GameLogicService::canMatch(const CardModel& card1, const CardModel& card2)
 {
@@ -21,9 +21,14 @@ bool GameLogicService::processCardMatch(GameModel& gameModel, int mainCardId)
         return false;
     }
 
-    const CardModel& bottomCard = gameModel.getBottomCard();
+    // 底牌区为空时没有匹配目标
+    const CardModel* bottomCard = gameModel.getTopBottomCard();
+    if (!bottomCard)
+    {
+        return false;
+    }
 
-    if (canMatch(*mainCard, bottomCard))
+    if (canMatch(*mainCard, *bottomCard))
     {
         return true;
     }
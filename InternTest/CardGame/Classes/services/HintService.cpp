@@ -0,0 +1,78 @@
+#include "HintService.h"
+#include "MoveGeneratorService.h"
+
+namespace
+{
+    // 某区域前 count 张卡牌（从栈底算起）的数值掩码
+    uint16_t getZoneRankMask(const PackedGameState& state, PackedGameState::Zone zone, int count)
+    {
+        const uint8_t* ranks = state.getRankLane(zone);
+        uint16_t mask = 0;
+        for (int i = 0; i < count; i++)
+        {
+            mask |= static_cast<uint16_t>(1u << ranks[i]);
+        }
+        return mask;
+    }
+
+    int getTopId(const PackedGameState& state, PackedGameState::Zone zone)
+    {
+        return state.getId(zone, state.getCount(zone) - 1);
+    }
+}
+
+bool HintService::getHeuristicMove(const PackedGameState& state, GameMove& outMove)
+{
+    uint64_t playable = MoveGeneratorService::getPlayableMainSlots(state);
+    if (playable)
+    {
+        int index = MoveGeneratorService::lowestSlot(playable);
+        outMove = GameMove(GameMove::PLAY_MAIN, state.getId(PackedGameState::MAIN, index));
+        return true;
+    }
+
+    // 能让某张未被覆盖的主牌变为可匹配的底牌数值（与求解器的翻牌目标一致）
+    uint16_t targetRanks = RankIndex::getNeighbours(state.getUncoveredMainRankMask());
+
+    int spareCount = state.getCount(PackedGameState::SPARE);
+    if (spareCount > 0 && (state.getRankMask(PackedGameState::SPARE) & targetRanks))
+    {
+        outMove = GameMove(GameMove::SPARE_TO_BOTTOM, getTopId(state, PackedGameState::SPARE));
+        return true;
+    }
+
+    // 栈顶底牌已确认无法匹配，只看其下方的底牌
+    int bottomCount = state.getCount(PackedGameState::BOTTOM);
+    if (bottomCount > 1 && (getZoneRankMask(state, PackedGameState::BOTTOM, bottomCount - 1) & targetRanks))
+    {
+        outMove = GameMove(GameMove::BOTTOM_TO_SPARE, getTopId(state, PackedGameState::BOTTOM));
+        return true;
+    }
+
+    // 没有目标时仍可翻牌，只是不会带来进展
+    if (spareCount > 0)
+    {
+        outMove = GameMove(GameMove::SPARE_TO_BOTTOM, getTopId(state, PackedGameState::SPARE));
+        return true;
+    }
+    return false;
+}
+
+HintService::Hint HintService::computeHint(const PackedGameState& state, const SolverService::Limits& limits)
+{
+    Hint hint;
+    hint.hasMove = getHeuristicMove(state, hint.move);
+    if (!hint.hasMove)
+    {
+        return hint;
+    }
+
+    SolverService::Result result = SolverService::solve(state, limits);
+    hint.status = result.status;
+    hint.nodes = result.nodes;
+    if (result.status == SolverService::Result::WINNABLE && !result.witness.empty())
+    {
+        hint.move = result.witness.front();
+    }
+    return hint;
+}
@@ -0,0 +1,48 @@
+#ifndef __HINT_SERVICE_H__
+#define __HINT_SERVICE_H__
+
+#include "../models/GameMove.h"
+#include "../models/PackedGameState.h"
+#include "SolverService.h"
+
+/**
+ * 提示计算服务
+ * 职责：为当前局面给出推荐操作，不依赖引擎，可在工作线程中调用
+ * 算法：先用启发式规则立即得到一个候选操作，再在预算内求解；
+ *       求解成功时以解法的第一步替换候选操作，超出预算时保留启发式结果
+ */
+class HintService
+{
+public:
+    // 提示结果
+    struct Hint
+    {
+        bool hasMove;                           // 是否存在可执行的操作
+        GameMove move;                          // 推荐操作
+        SolverService::Result::Status status;   // 求解结论，UNKNOWN表示仅为启发式结果
+        long long nodes;                        // 求解节点数
+
+        Hint() : hasMove(false), status(SolverService::Result::UNKNOWN), nodes(0) {}
+    };
+
+    /**
+     * 计算提示
+     * @param state 局面快照
+     * @param limits 求解预算与取消标记
+     * @return 提示结果
+     */
+    static Hint computeHint(const PackedGameState& state, const SolverService::Limits& limits);
+
+    /**
+     * 启发式候选操作：优先打出可匹配主牌，其次朝存在匹配目标的方向翻牌
+     * @param state 局面快照
+     * @param outMove 输出的候选操作
+     * @return 是否存在可执行的操作
+     */
+    static bool getHeuristicMove(const PackedGameState& state, GameMove& outMove);
+
+private:
+    HintService() = delete;  // 禁止实例化
+};
+
+#endif // __HINT_SERVICE_H__
@@ -0,0 +1,105 @@
+#include "MoveGeneratorService.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MOVE_GENERATOR_USE_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define MOVE_GENERATOR_USE_NEON 1
+#endif
+
+namespace
+{
+    // 对16个数值做相邻判定，返回16位结果掩码
+    inline uint32_t matchBlock16(const uint8_t* ranks, int lowRank, int highRank)
+    {
+#if MOVE_GENERATOR_USE_SSE2
+        __m128i values = _mm_load_si128(reinterpret_cast<const __m128i*>(ranks));
+        __m128i matches = _mm_or_si128(_mm_cmpeq_epi8(values, _mm_set1_epi8(static_cast<char>(lowRank))),
+                                       _mm_cmpeq_epi8(values, _mm_set1_epi8(static_cast<char>(highRank))));
+        return static_cast<uint32_t>(_mm_movemask_epi8(matches));
+#elif MOVE_GENERATOR_USE_NEON
+        static const uint8_t kBitWeights[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+        uint8x16_t values = vld1q_u8(ranks);
+        uint8x16_t matches = vorrq_u8(vceqq_u8(values, vdupq_n_u8(static_cast<uint8_t>(lowRank))),
+                                      vceqq_u8(values, vdupq_n_u8(static_cast<uint8_t>(highRank))));
+        uint8x16_t weighted = vandq_u8(matches, vld1q_u8(kBitWeights));
+        // 两半分别横向求和：结果第0字节为低8位，第1字节为高8位
+        uint8x8_t sum = vpadd_u8(vget_low_u8(weighted), vget_high_u8(weighted));
+        sum = vpadd_u8(sum, sum);
+        sum = vpadd_u8(sum, sum);
+        return static_cast<uint32_t>(vget_lane_u8(sum, 0)) | (static_cast<uint32_t>(vget_lane_u8(sum, 1)) << 8);
+#else
+        uint32_t mask = 0;
+        for (int i = 0; i < 16; i++)
+        {
+            if (ranks[i] == lowRank || ranks[i] == highRank)
+            {
+                mask |= 1u << i;
+            }
+        }
+        return mask;
+#endif
+    }
+}
+
+uint64_t MoveGeneratorService::getPlayableMainSlots(const PackedGameState& state)
+{
+    int bottomRank = state.getTopBottomRank();
+    int count = state.getCount(PackedGameState::MAIN);
+    if (bottomRank == 0 || count == 0)
+    {
+        return 0;
+    }
+
+    // 主牌区没有相邻数值时无需逐张比较
+    uint16_t neighbours = RankIndex::getNeighbours(static_cast<uint16_t>(1u << bottomRank));
+    if ((state.getRankMask(PackedGameState::MAIN) & neighbours) == 0)
+    {
+        return 0;
+    }
+
+    const uint8_t* ranks = state.getRankLane(PackedGameState::MAIN);
+    uint64_t slots = 0;
+    for (int i = 0; i < count; i += 16)
+    {
+        slots |= static_cast<uint64_t>(matchBlock16(ranks + i, bottomRank - 1, bottomRank + 1)) << i;
+    }
+
+    // 去掉超出卡牌数量的空位（空位数值为0，会与ACE的下邻数值误配）
+    if (count < 64)
+    {
+        slots &= (1ull << count) - 1;
+    }
+
+    // 去掉被覆盖的主牌：只检查数值已匹配的少数几张
+    if (state.hasCovers())
+    {
+        uint64_t candidates = slots;
+        while (candidates)
+        {
+            int index = lowestSlot(candidates);
+            candidates &= candidates - 1;
+            if (state.isMainCovered(index))
+            {
+                slots &= ~(1ull << index);
+            }
+        }
+    }
+    return slots;
+}
+
+int MoveGeneratorService::lowestSlot(uint64_t slots)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(slots);
+#else
+    int index = 0;
+    while (!(slots & 1))
+    {
+        slots >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
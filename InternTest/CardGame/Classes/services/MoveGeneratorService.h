@@ -0,0 +1,33 @@
+#ifndef __MOVE_GENERATOR_SERVICE_H__
+#define __MOVE_GENERATOR_SERVICE_H__
+
+#include "../models/PackedGameState.h"
+#include <cstdint>
+
+/**
+ * 合法移动生成服务
+ * 职责：用数值位掩码批量求出可与底牌匹配的主牌，供提示、死局检测和求解器的内层循环使用
+ * 数值掩码约定：第r位表示数值r（ACE=1 … KING=13），第0位不使用
+ */
+class MoveGeneratorService
+{
+public:
+    /**
+     * 一次性判定紧凑状态中全部主牌是否可与底牌匹配（支持SSE2/NEON时按16张一组并行比较），被覆盖的主牌除外
+     * @param state 紧凑游戏状态
+     * @return 以主牌区下标为位序的可匹配掩码
+     */
+    static uint64_t getPlayableMainSlots(const PackedGameState& state);
+
+    /**
+     * 获取掩码中最低位的下标
+     * @param slots 非零掩码
+     * @return 最低置位的下标
+     */
+    static int lowestSlot(uint64_t slots);
+
+private:
+    MoveGeneratorService() = delete;  // 禁止实例化
+};
+
+#endif // __MOVE_GENERATOR_SERVICE_H__
@@ -1,13 +1,62 @@
 #include "ResourceService.h"
+#include "../utils/AssetPack.h"
+
+namespace
+{
+    // 同一尺寸、颜色的13张数值图片路径，编译期拼接
+#define CARD_VALUE_PATHS(prefix) \
+    "res/number/" prefix "A.png", "res/number/" prefix "2.png", "res/number/" prefix "3.png", \
+    "res/number/" prefix "4.png", "res/number/" prefix "5.png", "res/number/" prefix "6.png", \
+    "res/number/" prefix "7.png", "res/number/" prefix "8.png", "res/number/" prefix "9.png", \
+    "res/number/" prefix "10.png", "res/number/" prefix "J.png", "res/number/" prefix "Q.png", \
+    "res/number/" prefix "K.png"
+
+    // 资源ID到图片路径的映射，顺序与 ResourceService::ResourceId 一致
+    const char* const RESOURCE_PATHS[] = {
+        "res/card_general.png",
+        "res/card_back.png",  // 使用专门的卡牌背面图片
+        "res/suits/heart.png",
+        "res/suits/diamond.png",
+        "res/suits/club.png",
+        "res/suits/spade.png",
+        CARD_VALUE_PATHS("big_red_"),
+        CARD_VALUE_PATHS("big_black_"),
+        CARD_VALUE_PATHS("small_red_"),
+        CARD_VALUE_PATHS("small_black_"),
+    };
+
+#undef CARD_VALUE_PATHS
+
+    // 预解码资源包，首次使用时打开，运行期间保持映射
+    AssetPack s_assetPack;
+    bool s_assetPackOpened = false;
+
+    // 读取整个文件（用于无法内存映射的情况，如安卓 APK 内的资源）
+    std::vector<uint8_t> readFileBytes(const std::string& fullPath)
+    {
+        Data data = FileUtils::getInstance()->getDataFromFile(fullPath);
+        return std::vector<uint8_t>(data.getBytes(), data.getBytes() + data.getSize());
+    }
+
+    static_assert(sizeof(RESOURCE_PATHS) / sizeof(RESOURCE_PATHS[0]) == ResourceService::RES_COUNT,
+                  "RESOURCE_PATHS must match ResourceService::ResourceId");
+}
+
+SpriteFrame* ResourceService::s_frames[ResourceService::RES_COUNT] = {};
 
 // 资源路径常量定义
-const std::string ResourceService::Paths::CARD_BACKGROUND = "res/card_general.png";
-const std::string ResourceService::Paths::CARD_BACK = "res/card_back.png";  // 使用专门的卡牌背面图片
+const std::string ResourceService::Paths::CARD_ATLAS_PLIST = "res/cards.plist";
+const std::string ResourceService::Paths::CARD_ATLAS_TEXTURE = "res/cards.png";
+const std::string ResourceService::Paths::ASSET_PACK = "res/assets.pak";
+const std::string ResourceService::Paths::ASSET_PATCH = "res/assets_patch.pak";
 
-const std::string ResourceService::Paths::SUIT_HEARTS = "res/suits/heart.png";
-const std::string ResourceService::Paths::SUIT_DIAMONDS = "res/suits/diamond.png";
-const std::string ResourceService::Paths::SUIT_CLUBS = "res/suits/club.png";
-const std::string ResourceService::Paths::SUIT_SPADES = "res/suits/spade.png";
+const std::string ResourceService::Paths::CARD_BACKGROUND = RESOURCE_PATHS[RES_CARD_BACKGROUND];
+const std::string ResourceService::Paths::CARD_BACK = RESOURCE_PATHS[RES_CARD_BACK];
+
+const std::string ResourceService::Paths::SUIT_HEARTS = RESOURCE_PATHS[getSuitImageId(CardModel::HEARTS)];
+const std::string ResourceService::Paths::SUIT_DIAMONDS = RESOURCE_PATHS[getSuitImageId(CardModel::DIAMONDS)];
+const std::string ResourceService::Paths::SUIT_CLUBS = RESOURCE_PATHS[getSuitImageId(CardModel::CLUBS)];
+const std::string ResourceService::Paths::SUIT_SPADES = RESOURCE_PATHS[getSuitImageId(CardModel::SPADES)];
 
 const std::string ResourceService::Paths::NUMBER_DIR = "res/number/";
 
@@ -19,28 +68,12 @@ const std::string ResourceService::Paths::CLOSE_SELECTED = "CloseSelected.png";
 
 std::string ResourceService::getCardValueImagePath(CardModel::Value value, bool isRed, bool isLarge)
 {
-    std::string prefix = isLarge ? "big_" : "small_";
-    std::string color = isRed ? "red_" : "black_";
-    std::string valueStr = getValueString(value);
-
-    return Paths::NUMBER_DIR + prefix + color + valueStr + ".png";
+    return RESOURCE_PATHS[getValueImageId(value, isRed, isLarge)];
 }
 
 std::string ResourceService::getSuitImagePath(CardModel::Suit suit)
 {
-    switch (suit)
-    {
-        case CardModel::HEARTS:
-            return Paths::SUIT_HEARTS;
-        case CardModel::DIAMONDS:
-            return Paths::SUIT_DIAMONDS;
-        case CardModel::CLUBS:
-            return Paths::SUIT_CLUBS;
-        case CardModel::SPADES:
-            return Paths::SUIT_SPADES;
-        default:
-            return Paths::SUIT_HEARTS;
-    }
+    return RESOURCE_PATHS[getSuitImageId(suit)];
 }
 
 ResourceService::CardResources ResourceService::getCardResources(const CardModel& cardModel)
@@ -63,43 +96,146 @@ ResourceService::CardResources ResourceService::getCardResources(const CardModel
     return resources;
 }
 
-void ResourceService::preloadCardResources()
+void ResourceService::getStartupTexturePaths(std::vector<std::string>& critical, std::vector<std::string>& deferred)
 {
-    auto textureCache = Director::getInstance()->getTextureCache();
+    if (isResourceExists(Paths::CARD_ATLAS_PLIST))
+    {
+        // 整副牌共用一张图集纹理
+        critical.push_back(Paths::CARD_ATLAS_TEXTURE);
+    }
+    else
+    {
+        // 没有图集时先加载绘制牌面主体所需的图片，角标小数值延后
+        for (int id = RES_CARD_BACKGROUND; id < RES_COUNT; id++)
+        {
+            bool isSmallValue = id >= getValueImageId(CardModel::ACE, true, false);
+            (isSmallValue ? deferred : critical).push_back(RESOURCE_PATHS[id]);
+        }
+    }
+    critical.push_back(Paths::CLOSE_NORMAL);
+    critical.push_back(Paths::CLOSE_SELECTED);
+}
 
-    // 预加载卡牌背景和背面
-    textureCache->addImage(Paths::CARD_BACKGROUND);
-    textureCache->addImage(Paths::CARD_BACK);
+void ResourceService::preloadCardResources()
+{
+    // 图集包含全部卡牌元素，加载后无需再逐个加载图片
+    if (isResourceExists(Paths::CARD_ATLAS_PLIST))
+    {
+        SpriteFrameCache::getInstance()->addSpriteFramesWithFile(Paths::CARD_ATLAS_PLIST);
+        resolveResourceIds();
+        return;
+    }
+    CCLOG("Warning: card atlas not found, loading separate images: %s", Paths::CARD_ATLAS_PLIST.c_str());
 
     // 验证背面图片是否存在
     if (!isResourceExists(Paths::CARD_BACK))
     {
         CCLOG("Warning: Card back image not found: %s", Paths::CARD_BACK.c_str());
     }
-    
-    // 预加载花色图片
-    textureCache->addImage(Paths::SUIT_HEARTS);
-    textureCache->addImage(Paths::SUIT_DIAMONDS);
-    textureCache->addImage(Paths::SUIT_CLUBS);
-    textureCache->addImage(Paths::SUIT_SPADES);
-    
-    // 预加载所有数值图片
-    std::vector<CardModel::Value> values = {
-        CardModel::ACE, CardModel::TWO, CardModel::THREE, CardModel::FOUR,
-        CardModel::FIVE, CardModel::SIX, CardModel::SEVEN, CardModel::EIGHT,
-        CardModel::NINE, CardModel::TEN, CardModel::JACK, CardModel::QUEEN, CardModel::KING
-    };
-    
-    for (auto value : values)
+
+    // 解析已加载的卡牌背景、背面、花色和数值图片，其余图片在首次使用时加载
+    resolveResourceIds();
+}
+
+SpriteFrame* ResourceService::getSpriteFrame(const std::string& path)
+{
+    auto frameCache = SpriteFrameCache::getInstance();
+    SpriteFrame* frame = frameCache->getSpriteFrameByName(path);
+    if (frame)
     {
-        // 预加载大尺寸红色和黑色数字
-        textureCache->addImage(getCardValueImagePath(value, true, true));
-        textureCache->addImage(getCardValueImagePath(value, false, true));
-        
-        // 预加载小尺寸红色和黑色数字
-        textureCache->addImage(getCardValueImagePath(value, true, false));
-        textureCache->addImage(getCardValueImagePath(value, false, false));
+        return frame;
     }
+
+    // 回退：使用单独的图片（优先取资源包中的预解码数据），创建整张纹理的帧并以路径为名缓存，下次直接命中
+    Texture2D* texture = loadPackedTexture(path);
+    if (!texture)
+    {
+        texture = Director::getInstance()->getTextureCache()->addImage(path);
+    }
+    if (!texture)
+    {
+        return nullptr;
+    }
+    frame = SpriteFrame::createWithTexture(texture, Rect(Vec2::ZERO, texture->getContentSize()));
+    frameCache->addSpriteFrame(frame, path);
+    return frame;
+}
+
+Texture2D* ResourceService::loadPackedTexture(const std::string& path)
+{
+    if (!openAssetPack())
+    {
+        return nullptr;
+    }
+    const AssetPack::Entry* entry = s_assetPack.find(path);
+    if (!entry)
+    {
+        return nullptr;
+    }
+
+    // 与 TextureCache::addImage(path) 使用相同的键，后续按路径加载直接命中
+    auto textureCache = Director::getInstance()->getTextureCache();
+    auto fileUtils = FileUtils::getInstance();
+    std::string key = fileUtils->isFileExist(path) ? fileUtils->fullPathForFilename(path) : path;
+    Texture2D* texture = textureCache->getTextureForKey(key);
+    if (texture)
+    {
+        return texture;
+    }
+
+    // 源图片仍在且与打包时不同（重新生成图片后未重新打包）时不用资源包，回退到解码 PNG
+    if (fileUtils->isFileExist(path))
+    {
+        Data source = fileUtils->getDataFromFile(path);
+        if (!AssetPack::matchesSource(*entry, source.getBytes(), static_cast<size_t>(source.getSize())))
+        {
+            CCLOG("Warning: asset pack entry is stale, loading source image: %s", path.c_str());
+            return nullptr;
+        }
+    }
+
+    // 像素已预乘透明度，只需复制一次再上传，不做解压
+    Image* image = new (std::nothrow) Image();
+    if (image && image->initWithRawData(entry->data, entry->dataSize, static_cast<int>(entry->width),
+                                        static_cast<int>(entry->height), 8, true))
+    {
+        texture = textureCache->addImage(image, key);
+    }
+    CC_SAFE_RELEASE(image);
+    return texture;
+}
+
+bool ResourceService::openAssetPack()
+{
+    if (s_assetPackOpened)
+    {
+        return s_assetPack.isOpen();
+    }
+    s_assetPackOpened = true;
+
+    auto fileUtils = FileUtils::getInstance();
+    if (!fileUtils->isFileExist(Paths::ASSET_PACK))
+    {
+        return false;
+    }
+    std::string packPath = fileUtils->fullPathForFilename(Paths::ASSET_PACK);
+    // 优先内存映射，失败时（如文件位于安卓 APK 内）读入内存
+    if (!s_assetPack.openFile(packPath) && !s_assetPack.openMemory(readFileBytes(packPath)))
+    {
+        CCLOG("Warning: invalid asset pack: %s", packPath.c_str());
+        return false;
+    }
+
+    if (!fileUtils->isFileExist(Paths::ASSET_PATCH))
+    {
+        return true;
+    }
+    std::string patchPath = fileUtils->fullPathForFilename(Paths::ASSET_PATCH);
+    if (!s_assetPack.applyPatchFile(patchPath) && !s_assetPack.applyPatchMemory(readFileBytes(patchPath)))
+    {
+        CCLOG("Warning: asset patch %s does not apply to pack revision %u", patchPath.c_str(), s_assetPack.getRevision());
+    }
+    return true;
 }
 
 bool ResourceService::isResourceExists(const std::string& path)
@@ -107,23 +243,59 @@ bool ResourceService::isResourceExists(const std::string& path)
     return FileUtils::getInstance()->isFileExist(path);
 }
 
-std::string ResourceService::getValueString(CardModel::Value value)
+SpriteFrame* ResourceService::getSpriteFrame(ResourceId id)
+{
+    if (id < 0 || id >= RES_COUNT)
+    {
+        return nullptr;
+    }
+    if (!s_frames[id])
+    {
+        // 未预加载时按需解析一次
+        s_frames[id] = getSpriteFrame(std::string(RESOURCE_PATHS[id]));
+        CC_SAFE_RETAIN(s_frames[id]);
+    }
+    return s_frames[id];
+}
+
+Texture2D* ResourceService::getTexture(ResourceId id)
+{
+    SpriteFrame* frame = getSpriteFrame(id);
+    return frame ? frame->getTexture() : nullptr;
+}
+
+const char* ResourceService::getResourcePath(ResourceId id)
 {
-    switch (value)
-    {
-        case CardModel::ACE: return "A";
-        case CardModel::TWO: return "2";
-        case CardModel::THREE: return "3";
-        case CardModel::FOUR: return "4";
-        case CardModel::FIVE: return "5";
-        case CardModel::SIX: return "6";
-        case CardModel::SEVEN: return "7";
-        case CardModel::EIGHT: return "8";
-        case CardModel::NINE: return "9";
-        case CardModel::TEN: return "10";
-        case CardModel::JACK: return "J";
-        case CardModel::QUEEN: return "Q";
-        case CardModel::KING: return "K";
-        default: return "A";
+    return (id >= 0 && id < RES_COUNT) ? RESOURCE_PATHS[id] : "";
+}
+
+ResourceService::CardFrames ResourceService::getCardFrames(const CardModel& cardModel)
+{
+    CardFrames frames = { nullptr, nullptr, nullptr, nullptr };
+    if (!cardModel.isFaceUp())
+    {
+        frames.background = getSpriteFrame(RES_CARD_BACK);
+        return frames;
+    }
+
+    frames.background = getSpriteFrame(RES_CARD_BACKGROUND);
+    frames.value = getSpriteFrame(getValueImageId(cardModel.getValue(), cardModel.isRed(), true));
+    frames.smallValue = getSpriteFrame(getValueImageId(cardModel.getValue(), cardModel.isRed(), false));
+    frames.suit = getSpriteFrame(getSuitImageId(cardModel.getSuit()));
+    return frames;
+}
+
+void ResourceService::resolveResourceIds()
+{
+    // 重新加载图集后旧帧可能已被替换，先释放再解析；纹理尚未加载的资源留待首次使用时解析，避免在此同步解码
+    auto frameCache = SpriteFrameCache::getInstance();
+    auto textureCache = Director::getInstance()->getTextureCache();
+    for (int id = 0; id < RES_COUNT; id++)
+    {
+        CC_SAFE_RELEASE_NULL(s_frames[id]);
+        if (frameCache->getSpriteFrameByName(RESOURCE_PATHS[id]) || textureCache->getTextureForKey(RESOURCE_PATHS[id]))
+        {
+            getSpriteFrame(static_cast<ResourceId>(id));
+        }
     }
 }
@@ -4,6 +4,7 @@
 #include "cocos2d.h"
 #include "../models/CardModel.h"
 #include <string>
+#include <vector>
 
 USING_NS_CC;
 
@@ -14,9 +15,66 @@ USING_NS_CC;
 class ResourceService
 {
 public:
+    /**
+     * 卡牌资源ID：编译期确定的整数句柄
+     * 路径表与ID一一对应，预加载时把每个ID解析为精灵帧并缓存，
+     * 运行时按ID取帧，不再拼接路径字符串，也不再按路径做哈希查找
+     * 数值图片按（尺寸, 颜色, 数值）排列：大红、大黑、小红、小黑各13张
+     */
+    enum ResourceId
+    {
+        RES_CARD_BACKGROUND = 0,                            // 卡牌背景
+        RES_CARD_BACK,                                      // 卡牌背面
+        RES_SUIT_FIRST,                                     // 花色图标，按 CardModel::Suit 顺序
+        RES_VALUE_FIRST = RES_SUIT_FIRST + 4,               // 数值图片
+        RES_COUNT = RES_VALUE_FIRST + 4 * 13
+    };
+
+    /**
+     * 花色图标的资源ID
+     * @param suit 花色
+     * @return 资源ID
+     */
+    static constexpr ResourceId getSuitImageId(CardModel::Suit suit)
+    {
+        return static_cast<ResourceId>(RES_SUIT_FIRST + static_cast<int>(suit));
+    }
+
+    /**
+     * 数值图片的资源ID
+     * @param value 卡牌数值
+     * @param isRed 是否为红色
+     * @param isLarge 是否为大尺寸
+     * @return 资源ID
+     */
+    static constexpr ResourceId getValueImageId(CardModel::Value value, bool isRed, bool isLarge = true)
+    {
+        return static_cast<ResourceId>(RES_VALUE_FIRST + ((isLarge ? 0 : 2) + (isRed ? 0 : 1)) * 13
+                                       + (static_cast<int>(value) - 1));
+    }
+
+    /**
+     * 卡牌正面各元素的精灵帧（背面只有 background 有效）
+     */
+    struct CardFrames
+    {
+        SpriteFrame* background;        // 背景或牌背
+        SpriteFrame* value;             // 中央大数值
+        SpriteFrame* smallValue;        // 角标小数值
+        SpriteFrame* suit;              // 角标花色
+    };
+
     // 资源路径常量
     struct Paths
     {
+        // 卡牌图集（由 tools/build_atlas.py 生成，帧名即下列各图片路径）
+        static const std::string CARD_ATLAS_PLIST;          // 图集描述文件
+        static const std::string CARD_ATLAS_TEXTURE;        // 图集纹理
+
+        // 预解码资源包（由 tools/build_asset_pack.py 生成）
+        static const std::string ASSET_PACK;                // 完整包
+        static const std::string ASSET_PATCH;               // 增量补丁
+
         // 卡牌相关
         static const std::string CARD_BACKGROUND;           // 卡牌背景
         static const std::string CARD_BACK;                 // 卡牌背面
@@ -70,9 +128,61 @@ public:
     static CardResources getCardResources(const CardModel& cardModel);
     
     /**
-     * 预加载所有卡牌资源
+     * 启动时需要加载的纹理，按优先级分为两组
+     * @param critical 首局显示所需的纹理（图集，或图集缺失时的背景、牌背、花色和大数值图片，以及关闭按钮）
+     * @param deferred 可在进入游戏后后台加载的纹理
+     */
+    static void getStartupTexturePaths(std::vector<std::string>& critical, std::vector<std::string>& deferred);
+
+    /**
+     * 预加载卡牌资源：优先加载图集，图集缺失时解析已加载的单独图片（其余图片在首次使用时加载）
+     * 纹理已由异步加载放入 TextureCache 时，这里只注册精灵帧，不再解码图片
      */
     static void preloadCardResources();
+
+    /**
+     * 获取卡牌元素的精灵帧：优先从图集中查找，找不到时由单独的图片创建并缓存
+     * 同一图集中的帧共用一张纹理，渲染器可将整个牌面合批绘制
+     * @param path 图片路径（同时作为图集帧名）
+     * @return 精灵帧，图片不存在时返回nullptr
+     */
+    static SpriteFrame* getSpriteFrame(const std::string& path);
+
+    /**
+     * 从预解码资源包上传纹理并放入 TextureCache，之后按路径加载该纹理（含异步加载）会直接命中缓存
+     * 资源包在首次调用时内存映射并叠加补丁，整个运行期间保持映射
+     * @param path 图片路径（相对 Resources）
+     * @return 纹理，资源包中没有该图片时返回nullptr
+     */
+    static Texture2D* loadPackedTexture(const std::string& path);
+
+    /**
+     * 按资源ID获取缓存的精灵帧（常数时间，无内存分配）
+     * @param id 资源ID
+     * @return 精灵帧，图片不存在时返回nullptr
+     */
+    static SpriteFrame* getSpriteFrame(ResourceId id);
+
+    /**
+     * 按资源ID获取纹理（使用图集时为图集纹理）
+     * @param id 资源ID
+     * @return 纹理，图片不存在时返回nullptr
+     */
+    static Texture2D* getTexture(ResourceId id);
+
+    /**
+     * 获取资源ID对应的图片路径
+     * @param id 资源ID
+     * @return 图片路径（同时作为图集帧名）
+     */
+    static const char* getResourcePath(ResourceId id);
+
+    /**
+     * 获取卡牌当前朝向的各元素精灵帧
+     * @param cardModel 卡牌模型
+     * @return 精灵帧组合
+     */
+    static CardFrames getCardFrames(const CardModel& cardModel);
     
     /**
      * 检查资源文件是否存在
@@ -83,13 +193,14 @@ public:
 
 private:
     ResourceService() = delete;  // 禁止实例化
-    
-    /**
-     * 获取数值字符串
-     * @param value 卡牌数值
-     * @return 数值字符串
-     */
-    static std::string getValueString(CardModel::Value value);
+
+    static SpriteFrame* s_frames[RES_COUNT];  // 各资源ID解析后的精灵帧（已retain），未解析为nullptr
+
+    // 把已加载的资源ID解析为精灵帧
+    static void resolveResourceIds();
+
+    // 打开预解码资源包（仅首次调用时打开），返回是否可用
+    static bool openAssetPack();
 };
 
 #endif // __RESOURCE_SERVICE_H__
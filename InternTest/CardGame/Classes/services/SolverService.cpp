@@ -0,0 +1,259 @@
+#include "SolverService.h"
+#include "MoveGeneratorService.h"
+#include <algorithm>
+#include <chrono>
+
+namespace
+{
+    // 置换表：开放寻址的64位哈希集合，负载超过一半时扩容
+    class TranspositionTable
+    {
+    private:
+        std::vector<uint64_t> _slots;
+        size_t _size;
+
+    public:
+        explicit TranspositionTable(size_t capacity)
+            : _slots(capacity, 0), _size(0)
+        {
+        }
+
+        // 插入哈希，已存在时返回false
+        bool insert(uint64_t hash)
+        {
+            if (hash == 0)
+            {
+                hash = 1;  // 0 表示空槽
+            }
+            if ((_size + 1) * 2 > _slots.size())
+            {
+                grow();
+            }
+            if (!place(_slots, hash))
+            {
+                return false;
+            }
+            _size++;
+            return true;
+        }
+
+        size_t getMemoryBytes() const { return _slots.capacity() * sizeof(uint64_t); }
+
+    private:
+        static bool place(std::vector<uint64_t>& slots, uint64_t hash)
+        {
+            size_t mask = slots.size() - 1;
+            size_t index = static_cast<size_t>(hash) & mask;
+            while (slots[index] != 0)
+            {
+                if (slots[index] == hash)
+                {
+                    return false;
+                }
+                index = (index + 1) & mask;
+            }
+            slots[index] = hash;
+            return true;
+        }
+
+        void grow()
+        {
+            std::vector<uint64_t> larger(_slots.size() * 2, 0);
+            for (uint64_t hash : _slots)
+            {
+                if (hash != 0)
+                {
+                    place(larger, hash);
+                }
+            }
+            _slots.swap(larger);
+        }
+    };
+
+    // 搜索栈帧：记录到达该帧所做的操作，以便回溯
+    struct Frame
+    {
+        enum Stage {
+            STAGE_ENTER = 0,        // 首次进入
+            STAGE_DRAW_SPARE,       // 尝试备用牌翻到底牌区
+            STAGE_RETURN_BOTTOM,    // 尝试底牌退回备用区
+            STAGE_DONE              // 所有分支已展开
+        };
+
+        static const int NO_MOVE = -1;
+
+        int moveType;           // GameMove::Type，根节点为NO_MOVE
+        int cardId;
+        int mainIndex;          // 打出主牌时的主牌区下标
+        int stage;
+        uint16_t targetRanks;   // 能让某张主牌变为可匹配的底牌数值
+
+        Frame(int type, int id, int index)
+            : moveType(type), cardId(id), mainIndex(index), stage(STAGE_ENTER), targetRanks(0)
+        {
+        }
+    };
+
+    const size_t INITIAL_TABLE_CAPACITY = 1 << 8;
+    const long long LIMIT_CHECK_INTERVAL = 1024;
+
+    void undoFrameMove(PackedGameState& state, const Frame& frame)
+    {
+        switch (frame.moveType)
+        {
+            case GameMove::PLAY_MAIN: state.undoMoveMainToBottom(frame.mainIndex); break;
+            case GameMove::SPARE_TO_BOTTOM: state.moveBottomToSpare(); break;
+            case GameMove::BOTTOM_TO_SPARE: state.moveSpareToBottom(); break;
+            default: break;
+        }
+    }
+}
+
+SolverService::Result SolverService::solve(const GameModel& gameModel, const Limits& limits)
+{
+    PackedGameState state;
+    if (!PackedGameState::fromGameModel(gameModel, state))
+    {
+        return Result();
+    }
+    return solve(state, limits);
+}
+
+SolverService::Result SolverService::solve(const PackedGameState& initialState, const Limits& limits)
+{
+    typedef std::chrono::steady_clock Clock;
+    Clock::time_point start = Clock::now();
+
+    Result result;
+    PackedGameState state = initialState;
+    TranspositionTable table(INITIAL_TABLE_CAPACITY);
+    std::vector<Frame> stack;
+    stack.reserve(64);
+    stack.push_back(Frame(Frame::NO_MOVE, 0, 0));
+
+    bool aborted = false;
+    bool won = false;
+
+    // 节点上限较小时按上限缩短检查间隔，时间预算和取消请求不会被整段间隔拖延
+    long long checkInterval = LIMIT_CHECK_INTERVAL;
+    if (limits.maxNodes > 0)
+    {
+        checkInterval = std::min(checkInterval, limits.maxNodes);
+    }
+
+    while (!stack.empty())
+    {
+        Frame& frame = stack.back();
+
+        if (frame.stage == Frame::STAGE_ENTER)
+        {
+            // 节点上限逐个节点检查，搜索节点数不会超过 maxNodes
+            if (limits.maxNodes > 0 && result.nodes >= limits.maxNodes)
+            {
+                aborted = true;
+                break;
+            }
+            result.nodes++;
+
+            // 读时钟和取消标志有开销，按间隔检查
+            if (result.nodes % checkInterval == 0)
+            {
+                double elapsedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+                size_t memory = table.getMemoryBytes() + stack.capacity() * sizeof(Frame);
+                result.peakMemoryBytes = std::max(result.peakMemoryBytes, memory);
+                if ((limits.timeBudgetMs > 0.0 && elapsedMs >= limits.timeBudgetMs)
+                    || (limits.cancelFlag && limits.cancelFlag->load(std::memory_order_relaxed)))
+                {
+                    aborted = true;
+                    break;
+                }
+            }
+
+            if (state.isEmpty(PackedGameState::MAIN))
+            {
+                won = true;
+                break;
+            }
+
+            // 已经搜索过（或正在搜索）的局面不再展开；匹配与花色无关，仅花色不同的局面按同一局面处理
+            if (!table.insert(state.getCanonicalHash()))
+            {
+                undoFrameMove(state, frame);
+                stack.pop_back();
+                continue;
+            }
+
+            // 支配剪枝：存在可匹配主牌时只打出其中一张
+            // （牌阵存在覆盖时同样成立：打出的牌进入可任意翻动的底牌/备用区，且只会露出更多主牌，不会失去任何可能）
+            uint64_t playable = MoveGeneratorService::getPlayableMainSlots(state);
+            if (playable)
+            {
+                int index = MoveGeneratorService::lowestSlot(playable);
+                int cardId = state.getId(PackedGameState::MAIN, index);
+                frame.stage = Frame::STAGE_DONE;
+                state.moveMainToBottom(index);
+                stack.push_back(Frame(GameMove::PLAY_MAIN, cardId, index));
+                continue;
+            }
+
+            // 支配剪枝：翻动底牌/备用牌只为找到能匹配某张未被覆盖主牌的目标，区域中没有目标就不朝该方向翻
+            // （目标须取自未被覆盖的主牌，否则翻到目标也打不出牌，单方向展开不再成立）
+            frame.targetRanks = RankIndex::getNeighbours(state.getUncoveredMainRankMask());
+            frame.stage = Frame::STAGE_DRAW_SPARE;
+        }
+
+        // 两个方向只需展开一个：一旦翻到目标就会打出主牌，打出后的局面不劣于当前局面，
+        // 若该分支失败，另一方向同样无解（底牌区与备用区整体构成顺序可任意翻到的牌带，与牌阵是否有覆盖无关）
+        if (frame.stage == Frame::STAGE_DRAW_SPARE)
+        {
+            frame.stage = Frame::STAGE_RETURN_BOTTOM;
+            // 刚退回的底牌再翻回来只会回到父局面，跳过
+            if (!state.isEmpty(PackedGameState::SPARE) && frame.moveType != GameMove::BOTTOM_TO_SPARE
+                && (state.getRankMask(PackedGameState::SPARE) & frame.targetRanks))
+            {
+                int cardId = state.getId(PackedGameState::SPARE, state.getCount(PackedGameState::SPARE) - 1);
+                frame.stage = Frame::STAGE_DONE;
+                state.moveSpareToBottom();
+                stack.push_back(Frame(GameMove::SPARE_TO_BOTTOM, cardId, 0));
+                continue;
+            }
+        }
+
+        if (frame.stage == Frame::STAGE_RETURN_BOTTOM)
+        {
+            frame.stage = Frame::STAGE_DONE;
+            if (!state.isEmpty(PackedGameState::BOTTOM) && frame.moveType != GameMove::SPARE_TO_BOTTOM
+                && (state.getRankMask(PackedGameState::BOTTOM) & frame.targetRanks))
+            {
+                int cardId = state.getId(PackedGameState::BOTTOM, state.getCount(PackedGameState::BOTTOM) - 1);
+                state.moveBottomToSpare();
+                stack.push_back(Frame(GameMove::BOTTOM_TO_SPARE, cardId, 0));
+                continue;
+            }
+        }
+
+        // 所有分支已展开，回溯
+        undoFrameMove(state, frame);
+        stack.pop_back();
+    }
+
+    if (won)
+    {
+        result.status = Result::WINNABLE;
+        result.witness.reserve(stack.size() - 1);
+        for (size_t i = 1; i < stack.size(); i++)
+        {
+            result.witness.push_back(GameMove(static_cast<GameMove::Type>(stack[i].moveType), stack[i].cardId));
+        }
+    }
+    else
+    {
+        result.status = aborted ? Result::UNKNOWN : Result::UNWINNABLE;
+    }
+
+    result.elapsedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    result.nodesPerSecond = result.elapsedMs > 0.0 ? result.nodes * 1000.0 / result.elapsedMs : 0.0;
+    size_t memory = table.getMemoryBytes() + stack.capacity() * sizeof(Frame) + sizeof(PackedGameState);
+    result.peakMemoryBytes = std::max(result.peakMemoryBytes, memory);
+    return result;
+}
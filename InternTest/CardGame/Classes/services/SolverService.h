@@ -0,0 +1,71 @@
+#ifndef __SOLVER_SERVICE_H__
+#define __SOLVER_SERVICE_H__
+
+#include "../models/GameModel.h"
+#include "../models/GameMove.h"
+#include "../models/PackedGameState.h"
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/**
+ * 牌局可解性求解服务
+ * 职责：判断一副牌局能否清空主牌区，并给出一组可行的操作序列
+ * 算法：在紧凑状态上做迭代深度优先搜索，用忽略花色的规范Zobrist哈希置换表去除重复状态；
+ *       支配剪枝——底牌/备用牌可任意往返，打出可匹配的主牌只会增加后续的匹配目标，
+ *       因此存在可匹配主牌时只走"打出"这一条分支；否则只朝存在匹配目标的方向翻牌；
+ *       牌阵存在覆盖时同样成立：打出主牌只会露出更多主牌，不会让其他主牌失去匹配机会
+ */
+class SolverService
+{
+public:
+    // 搜索限制
+    struct Limits
+    {
+        long long maxNodes;                     // 最大搜索节点数，0表示不限
+        double timeBudgetMs;                    // 时间预算（毫秒），0表示不限
+        const std::atomic<bool>* cancelFlag;    // 外部取消标记，可为nullptr
+
+        Limits() : maxNodes(0), timeBudgetMs(0.0), cancelFlag(nullptr) {}
+    };
+
+    // 求解结果
+    struct Result
+    {
+        enum Status {
+            WINNABLE,       // 可解，witness为解法
+            UNWINNABLE,     // 已穷尽搜索，不可解
+            UNKNOWN         // 超出预算、被取消或牌局超出紧凑状态容量
+        };
+
+        Status status;
+        std::vector<GameMove> witness;  // 解法操作序列
+        long long nodes;                // 搜索节点数
+        double elapsedMs;               // 耗时（毫秒）
+        double nodesPerSecond;          // 每秒搜索节点数
+        size_t peakMemoryBytes;         // 置换表与搜索栈的峰值内存
+
+        Result() : status(UNKNOWN), nodes(0), elapsedMs(0.0), nodesPerSecond(0.0), peakMemoryBytes(0) {}
+    };
+
+    /**
+     * 求解游戏模型当前局面
+     * @param gameModel 游戏数据模型
+     * @param limits 搜索限制
+     * @return 求解结果
+     */
+    static Result solve(const GameModel& gameModel, const Limits& limits = Limits());
+
+    /**
+     * 求解紧凑状态
+     * @param state 紧凑游戏状态
+     * @param limits 搜索限制
+     * @return 求解结果
+     */
+    static Result solve(const PackedGameState& state, const Limits& limits = Limits());
+
+private:
+    SolverService() = delete;  // 禁止实例化
+};
+
+#endif // __SOLVER_SERVICE_H__
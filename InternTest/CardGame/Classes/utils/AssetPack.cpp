@@ -0,0 +1,274 @@
+#include "AssetPack.h"
+#include <algorithm>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    const char PACK_MAGIC[4] = { 'C', 'G', 'P', 'K' };
+
+    uint16_t readU16(const uint8_t* p)
+    {
+        return static_cast<uint16_t>(p[0] | (p[1] << 8));
+    }
+
+    uint32_t readU32(const uint8_t* p)
+    {
+        return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8)
+             | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+
+    uint64_t readU64(const uint8_t* p)
+    {
+        return static_cast<uint64_t>(readU32(p)) | (static_cast<uint64_t>(readU32(p + 4)) << 32);
+    }
+
+    // [offset, offset + length) 是否在 size 范围内
+    bool inRange(uint64_t offset, uint64_t length, uint64_t size)
+    {
+        return offset <= size && length <= size - offset;
+    }
+}
+
+AssetPack::AssetPack()
+    : _revision(0)
+{
+}
+
+AssetPack::~AssetPack()
+{
+    close();
+}
+
+bool AssetPack::openFile(const std::string& path)
+{
+    close();
+    Mapping* mapping = mapFile(path);
+    return mapping && load(mapping, false);
+}
+
+bool AssetPack::openMemory(std::vector<uint8_t>&& bytes)
+{
+    close();
+    Mapping* mapping = new Mapping();
+    mapping->buffer.swap(bytes);
+    mapping->data = mapping->buffer.data();
+    mapping->size = mapping->buffer.size();
+    mapping->mapped = false;
+    mapping->mapHandle = nullptr;
+    return load(mapping, false);
+}
+
+bool AssetPack::applyPatchFile(const std::string& path)
+{
+    if (!isOpen())
+    {
+        return false;
+    }
+    Mapping* mapping = mapFile(path);
+    return mapping && load(mapping, true);
+}
+
+bool AssetPack::applyPatchMemory(std::vector<uint8_t>&& bytes)
+{
+    if (!isOpen())
+    {
+        return false;
+    }
+    Mapping* mapping = new Mapping();
+    mapping->buffer.swap(bytes);
+    mapping->data = mapping->buffer.data();
+    mapping->size = mapping->buffer.size();
+    mapping->mapped = false;
+    mapping->mapHandle = nullptr;
+    return load(mapping, true);
+}
+
+void AssetPack::close()
+{
+    _entries.clear();
+    for (Mapping* mapping : _mappings)
+    {
+        unmap(mapping);
+    }
+    _mappings.clear();
+    _revision = 0;
+}
+
+const AssetPack::Entry* AssetPack::find(const std::string& name) const
+{
+    auto it = _entries.find(name);
+    return it != _entries.end() ? &it->second : nullptr;
+}
+
+bool AssetPack::matchesSource(const Entry& entry, const uint8_t* data, size_t size)
+{
+    return size == entry.sourceSize && computeSourceHash(data, size) == entry.sourceHash;
+}
+
+uint64_t AssetPack::computeSourceHash(const uint8_t* data, size_t size)
+{
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ data[i]) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+AssetPack::Mapping* AssetPack::mapFile(const std::string& path)
+{
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return nullptr;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return nullptr;
+    }
+    HANDLE mapHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);  // 映射对象持有文件引用
+    if (!mapHandle)
+    {
+        return nullptr;
+    }
+    void* view = MapViewOfFile(mapHandle, FILE_MAP_READ, 0, 0, 0);
+    if (!view)
+    {
+        CloseHandle(mapHandle);
+        return nullptr;
+    }
+
+    Mapping* mapping = new Mapping();
+    mapping->data = static_cast<const uint8_t*>(view);
+    mapping->size = static_cast<size_t>(fileSize.QuadPart);
+    mapping->mapped = true;
+    mapping->mapHandle = mapHandle;
+    return mapping;
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0)
+    {
+        ::close(fd);
+        return nullptr;
+    }
+    void* view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // 映射建立后即可关闭文件描述符
+    if (view == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    Mapping* mapping = new Mapping();
+    mapping->data = static_cast<const uint8_t*>(view);
+    mapping->size = static_cast<size_t>(st.st_size);
+    mapping->mapped = true;
+    mapping->mapHandle = nullptr;
+    return mapping;
+#endif
+}
+
+void AssetPack::unmap(Mapping* mapping)
+{
+    if (!mapping)
+    {
+        return;
+    }
+    if (mapping->mapped)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(mapping->data);
+        CloseHandle(static_cast<HANDLE>(mapping->mapHandle));
+#else
+        munmap(const_cast<uint8_t*>(mapping->data), mapping->size);
+#endif
+    }
+    delete mapping;
+}
+
+bool AssetPack::load(Mapping* mapping, bool isPatch)
+{
+    const uint8_t* data = mapping->data;
+    size_t size = mapping->size;
+
+    // 文件头
+    bool valid = size >= HEADER_SIZE
+              && std::equal(PACK_MAGIC, PACK_MAGIC + 4, reinterpret_cast<const char*>(data))
+              && readU16(data + 4) == FORMAT_VERSION;
+    uint32_t revision = valid ? readU32(data + 8) : 0;
+    uint32_t baseRevision = valid ? readU32(data + 12) : 0;
+    uint32_t entryCount = valid ? readU32(data + 16) : 0;
+    uint32_t indexOffset = valid ? readU32(data + 20) : 0;
+    uint32_t stringsOffset = valid ? readU32(data + 24) : 0;
+    uint32_t stringsSize = valid ? readU32(data + 28) : 0;
+
+    // 完整包的基础版本为0；补丁必须基于当前内容版本
+    valid = valid && (isPatch ? baseRevision == _revision && baseRevision != 0 : baseRevision == 0)
+                  && inRange(indexOffset, static_cast<uint64_t>(entryCount) * ENTRY_SIZE, size)
+                  && inRange(stringsOffset, stringsSize, size);
+
+    // 先解析到临时表，全部条目有效后再合并，避免损坏的补丁留下一半条目
+    std::vector<std::pair<std::string, Entry>> parsed;
+    if (valid)
+    {
+        parsed.reserve(entryCount);
+    }
+    for (uint32_t i = 0; valid && i < entryCount; i++)
+    {
+        const uint8_t* record = data + indexOffset + static_cast<size_t>(i) * ENTRY_SIZE;
+        uint32_t nameOffset = readU32(record);
+        uint16_t nameLength = readU16(record + 4);
+
+        Entry entry;
+        entry.pixelFormat = readU16(record + 6);
+        entry.width = readU32(record + 8);
+        entry.height = readU32(record + 12);
+        uint32_t dataOffset = readU32(record + 16);
+        entry.dataSize = readU32(record + 20);
+        entry.contentHash = readU64(record + 24);
+        entry.sourceSize = readU32(record + 32);
+        entry.sourceHash = readU64(record + 40);
+        entry.data = data + dataOffset;
+
+        valid = inRange(nameOffset, nameLength, stringsSize)
+             && inRange(dataOffset, entry.dataSize, size)
+             && entry.pixelFormat == RGBA8888_PREMULTIPLIED
+             && static_cast<uint64_t>(entry.width) * entry.height * 4 == entry.dataSize;
+        if (valid)
+        {
+            const char* name = reinterpret_cast<const char*>(data + stringsOffset + nameOffset);
+            parsed.push_back(std::make_pair(std::string(name, nameLength), entry));
+        }
+    }
+
+    if (!valid)
+    {
+        unmap(mapping);
+        return false;
+    }
+
+    for (auto& item : parsed)
+    {
+        _entries[item.first] = item.second;
+    }
+    _mappings.push_back(mapping);
+    _revision = revision;
+    return true;
+}
@@ -0,0 +1,141 @@
+#ifndef __ASSET_PACK_H__
+#define __ASSET_PACK_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * 预解码资源包（由 tools/build_asset_pack.py 生成）
+ * 职责：内存映射资源包文件并建立名称索引，纹理数据可直接上传，无需 PNG 解压
+ * 格式（小端）：
+ *   文件头 32 字节：magic "CGPK"、格式版本 u16、标志 u16、内容版本 u32、基础版本 u32、
+ *                   条目数 u32、索引偏移 u32、字符串表偏移 u32、字符串表大小 u32
+ *   索引：每条 48 字节，名称偏移 u32、名称长度 u16、像素格式 u16、宽 u32、高 u32、
+ *         数据偏移 u32、数据大小 u32、内容哈希 u64、源文件大小 u32、保留 u32、源文件哈希 u64
+ *   数据：按 16 字节对齐的像素数据
+ * 增量补丁：基础版本为 0 的是完整包；补丁包只含变化的条目，基础版本等于当前内容版本时才能叠加
+ * 源文件校验：条目记录打包时源 PNG 的大小和 FNV-1a 哈希，源文件被重新生成而资源包未更新时，
+ *             调用方据此跳过条目，避免静默加载旧像素
+ */
+class AssetPack
+{
+public:
+    static const uint16_t FORMAT_VERSION = 2;       // 支持的格式版本
+    static const size_t HEADER_SIZE = 32;
+    static const size_t ENTRY_SIZE = 48;
+
+    // 像素格式
+    enum PixelFormat
+    {
+        RGBA8888_PREMULTIPLIED = 1                  // 每像素4字节，颜色已预乘透明度
+    };
+
+    // 资源条目，数据指针指向映射的文件内容，在资源包关闭前有效
+    struct Entry
+    {
+        uint16_t pixelFormat;
+        uint32_t width;
+        uint32_t height;
+        const uint8_t* data;
+        uint32_t dataSize;
+        uint64_t contentHash;                       // 像素数据哈希，打包工具据此生成补丁
+        uint32_t sourceSize;                        // 打包时源 PNG 的字节数
+        uint64_t sourceHash;                        // 打包时源 PNG 的 FNV-1a 哈希
+    };
+
+private:
+    // 一个已打开的包文件（完整包或补丁包）
+    struct Mapping
+    {
+        const uint8_t* data;                        // 文件内容
+        size_t size;
+        bool mapped;                                // 是否为内存映射（否则内容在 buffer 中）
+        void* mapHandle;                            // Windows 文件映射句柄
+        std::vector<uint8_t> buffer;                // 无法映射时的文件内容副本
+    };
+
+    std::vector<Mapping*> _mappings;                // 完整包在前，补丁按叠加顺序在后
+    std::unordered_map<std::string, Entry> _entries; // 合并后的索引，补丁条目覆盖完整包条目
+    uint32_t _revision;                             // 当前内容版本（叠加补丁后为补丁的内容版本）
+
+public:
+    AssetPack();
+    ~AssetPack();
+
+    /**
+     * 内存映射并打开完整包，会先关闭已打开的包
+     * @param path 文件路径
+     * @return 文件存在且格式有效时返回true
+     */
+    bool openFile(const std::string& path);
+
+    /**
+     * 以内存中的文件内容打开完整包（用于无法映射的平台，如安卓 APK 内的资源）
+     * @param bytes 文件内容，所有权转移给资源包
+     * @return 格式有效时返回true
+     */
+    bool openMemory(std::vector<uint8_t>&& bytes);
+
+    /**
+     * 叠加补丁包（内存映射）
+     * @param path 补丁文件路径
+     * @return 补丁有效且基础版本与当前内容版本一致时返回true
+     */
+    bool applyPatchFile(const std::string& path);
+
+    /**
+     * 以内存中的文件内容叠加补丁包
+     * @param bytes 补丁文件内容，所有权转移给资源包
+     * @return 补丁有效且基础版本与当前内容版本一致时返回true
+     */
+    bool applyPatchMemory(std::vector<uint8_t>&& bytes);
+
+    // 关闭资源包并解除映射
+    void close();
+
+    bool isOpen() const { return !_mappings.empty(); }
+    uint32_t getRevision() const { return _revision; }
+    size_t getEntryCount() const { return _entries.size(); }
+
+    /**
+     * 按资源路径查找条目
+     * @param name 相对 Resources 的路径（如 res/cards.png）
+     * @return 条目，不存在时返回nullptr
+     */
+    const Entry* find(const std::string& name) const;
+
+    /**
+     * 条目是否由给定的源文件内容打包而来
+     * @param entry 条目
+     * @param data 源 PNG 文件内容
+     * @param size 文件字节数
+     * @return 大小与 FNV-1a 哈希都一致时返回true
+     */
+    static bool matchesSource(const Entry& entry, const uint8_t* data, size_t size);
+
+    // 64位 FNV-1a 哈希（与打包工具一致）
+    static uint64_t computeSourceHash(const uint8_t* data, size_t size);
+
+private:
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    // 映射文件，失败返回nullptr
+    static Mapping* mapFile(const std::string& path);
+
+    // 解除映射并释放
+    static void unmap(Mapping* mapping);
+
+    /**
+     * 校验文件头与索引并合并条目
+     * @param mapping 包文件
+     * @param isPatch 是否为补丁包
+     * @return 格式有效（补丁还要求基础版本匹配）时返回true，失败时不修改已有索引
+     */
+    bool load(Mapping* mapping, bool isPatch);
+};
+
+#endif // __ASSET_PACK_H__
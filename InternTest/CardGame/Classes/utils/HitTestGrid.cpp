@@ -0,0 +1,146 @@
+#include "HitTestGrid.h"
+#include <algorithm>
+#include <cmath>
+
+HitTestGrid::HitTestGrid(float cellSize)
+    : _cellSize(cellSize > 0.0f ? cellSize : 128.0f)
+    , _arrivalCounter(0)
+    , _count(0)
+{
+}
+
+void HitTestGrid::clear()
+{
+    _items.clear();
+    for (auto& cell : _cells)
+    {
+        cell.second.clear();
+    }
+    _arrivalCounter = 0;
+    _count = 0;
+}
+
+void HitTestGrid::setCellSize(float cellSize)
+{
+    if (cellSize > 0.0f && cellSize != _cellSize)
+    {
+        // 格子划分变化后原有登记全部失效
+        clear();
+        _cells.clear();
+        _cellSize = cellSize;
+    }
+}
+
+void HitTestGrid::insert(int id, float x, float y, float width, float height, int zOrder)
+{
+    if (id < 0)
+    {
+        return;
+    }
+    if (contains(id))
+    {
+        unlink(id);
+    }
+    else
+    {
+        if (static_cast<size_t>(id) >= _items.size())
+        {
+            Item empty = Item();
+            _items.resize(static_cast<size_t>(id) + 1, empty);
+        }
+        _count++;
+    }
+
+    Item& item = _items[id];
+    item.minX = x;
+    item.minY = y;
+    item.maxX = x + width;
+    item.maxY = y + height;
+    item.zOrder = zOrder;
+    item.arrival = _arrivalCounter++;
+    item.active = true;
+
+    int fromX = cellCoord(item.minX);
+    int toX = cellCoord(item.maxX);
+    int fromY = cellCoord(item.minY);
+    int toY = cellCoord(item.maxY);
+    for (int cellY = fromY; cellY <= toY; cellY++)
+    {
+        for (int cellX = fromX; cellX <= toX; cellX++)
+        {
+            _cells[cellKey(cellX, cellY)].push_back(id);
+        }
+    }
+}
+
+void HitTestGrid::remove(int id)
+{
+    if (!contains(id))
+    {
+        return;
+    }
+    unlink(id);
+    _items[id].active = false;
+    _count--;
+}
+
+bool HitTestGrid::contains(int id) const
+{
+    return id >= 0 && static_cast<size_t>(id) < _items.size() && _items[id].active;
+}
+
+int HitTestGrid::query(float x, float y) const
+{
+    auto it = _cells.find(cellKey(cellCoord(x), cellCoord(y)));
+    if (it == _cells.end())
+    {
+        return NO_HIT;
+    }
+
+    int hit = NO_HIT;
+    for (int id : it->second)
+    {
+        const Item& item = _items[id];
+        if (x < item.minX || x > item.maxX || y < item.minY || y > item.maxY)
+        {
+            continue;
+        }
+        if (hit == NO_HIT || item.zOrder > _items[hit].zOrder
+            || (item.zOrder == _items[hit].zOrder && item.arrival > _items[hit].arrival))
+        {
+            hit = id;
+        }
+    }
+    return hit;
+}
+
+int HitTestGrid::cellCoord(float value) const
+{
+    return static_cast<int>(std::floor(value / _cellSize));
+}
+
+int64_t HitTestGrid::cellKey(int cellX, int cellY)
+{
+    return static_cast<int64_t>((static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) | static_cast<uint32_t>(cellY));
+}
+
+void HitTestGrid::unlink(int id)
+{
+    const Item& item = _items[id];
+    int fromX = cellCoord(item.minX);
+    int toX = cellCoord(item.maxX);
+    int fromY = cellCoord(item.minY);
+    int toY = cellCoord(item.maxY);
+    for (int cellY = fromY; cellY <= toY; cellY++)
+    {
+        for (int cellX = fromX; cellX <= toX; cellX++)
+        {
+            auto it = _cells.find(cellKey(cellX, cellY));
+            if (it != _cells.end())
+            {
+                std::vector<int>& ids = it->second;
+                ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
+            }
+        }
+    }
+}
@@ -0,0 +1,79 @@
+#ifndef __HIT_TEST_GRID_H__
+#define __HIT_TEST_GRID_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * 点选用的均匀网格索引
+ * 职责：按格子登记矩形（如卡牌的显示区域），把一个点解析为覆盖它的最上层矩形的ID
+ * 复杂度：查询只扫描点所在格子中的矩形，与矩形总数无关；插入/移除与矩形覆盖的格子数成正比
+ * 层级：Z 值大的在上；Z 值相同时后插入的在上（与 cocos2d-x 同 Z 值按加入顺序绘制一致）
+ */
+class HitTestGrid
+{
+public:
+    static const int NO_HIT = -1;
+
+private:
+    // 已登记的矩形
+    struct Item
+    {
+        float minX, minY, maxX, maxY;
+        int zOrder;
+        uint32_t arrival;       // 插入顺序，用于同 Z 值时判定上下
+        bool active;
+    };
+
+    float _cellSize;                                        // 格子边长
+    std::vector<Item> _items;                               // 按ID索引
+    std::unordered_map<int64_t, std::vector<int>> _cells;   // 格子坐标 -> 覆盖该格子的ID
+    uint32_t _arrivalCounter;
+    size_t _count;
+
+public:
+    /**
+     * @param cellSize 格子边长，取单个矩形的尺寸附近时每个矩形只覆盖少数几个格子
+     */
+    explicit HitTestGrid(float cellSize = 128.0f);
+
+    // 清空所有矩形（保留容量），可同时修改格子边长
+    void clear();
+    void setCellSize(float cellSize);
+
+    /**
+     * 登记或更新矩形，更新时视为重新插入（同 Z 值下位于最上）
+     * @param id 非负ID
+     * @param x 左下角X
+     * @param y 左下角Y
+     * @param width 宽度
+     * @param height 高度
+     * @param zOrder 层级
+     */
+    void insert(int id, float x, float y, float width, float height, int zOrder);
+
+    // 移除矩形，ID不存在时无操作
+    void remove(int id);
+
+    bool contains(int id) const;
+    size_t size() const { return _count; }
+
+    /**
+     * 查询覆盖该点的最上层矩形
+     * @param x 点X
+     * @param y 点Y
+     * @return 矩形ID，没有矩形覆盖时返回 NO_HIT
+     */
+    int query(float x, float y) const;
+
+private:
+    int cellCoord(float value) const;
+    static int64_t cellKey(int cellX, int cellY);
+
+    // 从矩形覆盖的所有格子中移除该ID
+    void unlink(int id);
+};
+
+#endif // __HIT_TEST_GRID_H__
@@ -0,0 +1,34 @@
+#include "RandomGenerator.h"
+#include <chrono>
+#include <random>
+
+RandomGenerator::RandomGenerator(uint64_t seed, uint64_t stream)
+{
+    setSeed(seed, stream);
+}
+
+void RandomGenerator::setSeed(uint64_t seed, uint64_t stream)
+{
+    // PCG 参考实现的初始化流程
+    _state = 0;
+    _increment = (stream << 1) | 1u;
+    nextUInt32();
+    _state += seed;
+    nextUInt32();
+}
+
+uint64_t RandomGenerator::deriveSeed(uint64_t baseSeed, uint64_t index)
+{
+    uint64_t z = baseSeed + (index + 1) * 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+uint64_t RandomGenerator::generateSeed()
+{
+    std::random_device device;
+    uint64_t entropy = (static_cast<uint64_t>(device()) << 32) | device();
+    uint64_t now = static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    return deriveSeed(entropy, now);
+}
@@ -0,0 +1,91 @@
+#ifndef __RANDOM_GENERATOR_H__
+#define __RANDOM_GENERATOR_H__
+
+#include <cstdint>
+
+/**
+ * 可复现的伪随机数生成器（PCG32，XSH-RR 输出）
+ * 职责：为发牌提供按种子复现的随机序列；状态仅16字节，构造和步进开销极小
+ * 约定：区间映射使用 Lemire 乘法拒绝法，结果无偏且不依赖标准库分布的实现，
+ *       同一种子在所有平台上生成完全相同的牌局
+ */
+class RandomGenerator
+{
+private:
+    uint64_t _state;        // 线性同余状态
+    uint64_t _increment;    // 流编号（必须为奇数）
+
+public:
+    /**
+     * 构造生成器
+     * @param seed 种子
+     * @param stream 流编号，同一种子下不同流互不相关
+     */
+    explicit RandomGenerator(uint64_t seed = 0, uint64_t stream = 0);
+
+    // 重新设置种子
+    void setSeed(uint64_t seed, uint64_t stream = 0);
+
+    // 生成32位均匀随机数
+    uint32_t nextUInt32()
+    {
+        uint64_t oldState = _state;
+        _state = oldState * 6364136223846793005ull + _increment;
+        uint32_t xorShifted = static_cast<uint32_t>(((oldState >> 18) ^ oldState) >> 27);
+        uint32_t rotation = static_cast<uint32_t>(oldState >> 59);
+        return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31));
+    }
+
+    /**
+     * 生成 [0, bound) 内的无偏随机数
+     * @param bound 上界（大于0）
+     * @return 随机数
+     */
+    uint32_t nextBounded(uint32_t bound)
+    {
+        uint64_t product = static_cast<uint64_t>(nextUInt32()) * bound;
+        uint32_t low = static_cast<uint32_t>(product);
+        if (low < bound)
+        {
+            // 仅在可能落入偏置区间时才计算阈值，绝大多数调用没有除法
+            uint32_t threshold = (0u - bound) % bound;
+            while (low < threshold)
+            {
+                product = static_cast<uint64_t>(nextUInt32()) * bound;
+                low = static_cast<uint32_t>(product);
+            }
+        }
+        return static_cast<uint32_t>(product >> 32);
+    }
+
+    /**
+     * 生成 [minValue, maxValue] 内的无偏随机整数
+     * @param minValue 下界
+     * @param maxValue 上界（不小于下界）
+     * @return 随机整数
+     */
+    int nextInt(int minValue, int maxValue)
+    {
+        return minValue + static_cast<int>(nextBounded(static_cast<uint32_t>(maxValue - minValue) + 1u));
+    }
+
+    // 生成64位随机数，可作为子任务的种子
+    uint64_t nextUInt64()
+    {
+        uint64_t high = nextUInt32();
+        return (high << 32) | nextUInt32();
+    }
+
+    /**
+     * 由基础种子和序号派生独立的种子（splitmix64），用于批量发牌时按序号复现任一局
+     * @param baseSeed 基础种子
+     * @param index 序号
+     * @return 派生种子
+     */
+    static uint64_t deriveSeed(uint64_t baseSeed, uint64_t index);
+
+    // 生成不可预测的种子（随机设备与时钟混合）
+    static uint64_t generateSeed();
+};
+
+#endif // __RANDOM_GENERATOR_H__
@@ -9,23 +9,14 @@ USING_NS_CC;
 
 /**
  * 卡牌视图类
- * 职责：负责卡牌的显示和用户交互，不包含业务逻辑
+ * 职责：负责卡牌的显示，不包含业务逻辑；点选由 CardViewManager 统一处理
+ * 显示：整张牌面由 CardFaceCache 预先渲染，CardView 只是一个切换精灵帧的精灵，没有子节点
  */
 class CardView : public Sprite
 {
-public:
-    // 卡牌点击回调函数类型
-    typedef std::function<void(int cardId)> CardClickCallback;
-
 private:
     int _cardId;                    // 卡牌ID
     CardModel _cardModel;           // 卡牌数据模型
-    Sprite* _backgroundSprite;      // 背景精灵
-    Sprite* _valueSprite;           // 数值精灵
-    Sprite* _suitSprite;            // 花色精灵
-    Sprite* _smallValueSprite;      // 小数值精灵（左上角）
-    Sprite* _smallSuitSprite;       // 小花色精灵（左上角）
-    CardClickCallback _clickCallback; // 点击回调
 
 public:
     static CardView* create(const CardModel& cardModel);
@@ -38,9 +29,6 @@ public:
     // 获取卡牌ID
     int getCardId() const { return _cardId; }
     
-    // 设置点击回调
-    void setClickCallback(const CardClickCallback& callback) { _clickCallback = callback; }
-    
     // 更新显示
     void updateDisplay();
     
@@ -55,25 +43,25 @@ public:
     
     // 匹配失败动画
     void playMismatchAnimation();
+
+    // 提示高亮动画
+    void playHintAnimation();
     
     // 设置卡牌可交互性
     void setInteractable(bool interactable);
 
-private:
-    // 初始化触摸事件
-    void initTouchEvents();
+    // 回收前复位：停止动画并恢复缩放、颜色和可见性，供对象池复用
+    void resetForReuse();
 
-    // 创建精灵组件
-    void createSprites();
-
-    // 更新精灵显示
+private:
+    // 更新精灵显示（切换到当前朝向的精灵帧）
     void updateSprites();
 
+    // 获取当前朝向的精灵帧，牌面缓存不可用时回退到图集中的背景/牌背
+    SpriteFrame* getDisplayFrame() const;
+
     // 更新卡牌资源
     void updateCardResources();
-
-    // 触摸事件处理
-    bool onTouchBegan(Touch* touch, Event* event);
 };
 
 #endif // __CARD_VIEW_H__
@@ -0,0 +1,444 @@
+/**
+ * 核心逻辑行为测试
+ * 职责：脱离cocos2d-x引擎验证模型与纯逻辑服务的行为：操作日志的打包往返、紧凑卡牌编码往返、
+ *       GameModel 执行/撤销/重做后哈希回到原值、死局判断与数值掩码、求解器节点上限
+ * 运行：ctest（见 CMakeLists.txt 中的 cardgame_core_tests），任一检查失败时以非零状态退出
+ */
+
+#include "models/GameModel.h"
+#include "models/MoveJournal.h"
+#include "models/PackedCard.h"
+#include "models/PackedGameState.h"
+#include "models/RankIndex.h"
+#include "services/CardGeneratorService.h"
+#include "services/GameLogicService.h"
+#include "services/SolverService.h"
+#include "utils/RandomGenerator.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+    int g_checks = 0;
+    int g_failures = 0;
+
+    // 检查失败时打印位置并计数，不中断当前测试
+    #define CHECK(expr) \
+        do { \
+            g_checks++; \
+            if (!(expr)) { \
+                g_failures++; \
+                std::printf("  FAILED %s:%d: %s\n", __FILE__, __LINE__, #expr); \
+            } \
+        } while (0)
+
+    const uint64_t TEST_SEED = 20240601;
+
+    // 栈顶卡牌ID，栈为空时返回-1，用于构造底牌/备用操作
+    int topCardId(const std::vector<CardModel>& stack)
+    {
+        return stack.empty() ? -1 : stack.back().getId();
+    }
+
+    // 当前局面下的全部合法操作（打出可点击且与底牌相邻的主牌，翻动底牌/备用牌栈顶）
+    void collectLegalMoves(const GameModel& gameModel, std::vector<GameMove>& outMoves)
+    {
+        outMoves.clear();
+        const CardModel* bottom = gameModel.getTopBottomCard();
+        if (bottom)
+        {
+            for (const CardModel& card : gameModel.getMainCardStack())
+            {
+                if (gameModel.isCardClickable(card) && GameLogicService::canMatch(card, *bottom))
+                {
+                    outMoves.push_back(GameMove(GameMove::PLAY_MAIN, card.getId()));
+                }
+            }
+            outMoves.push_back(GameMove(GameMove::BOTTOM_TO_SPARE, bottom->getId()));
+        }
+        if (!gameModel.getSpareCardStack().empty())
+        {
+            outMoves.push_back(GameMove(GameMove::SPARE_TO_BOTTOM, topCardId(gameModel.getSpareCardStack())));
+        }
+    }
+
+    // 按定义逐张比较：主牌区未清空，且没有一张可点击主牌与底牌区/备用区任何一张数值相邻
+    bool isGameOverByScan(const GameModel& gameModel)
+    {
+        if (gameModel.getMainCardStack().empty())
+        {
+            return false;
+        }
+        for (const CardModel& card : gameModel.getMainCardStack())
+        {
+            if (!gameModel.isCardClickable(card))
+            {
+                continue;
+            }
+            for (const CardModel& stock : gameModel.getBottomCardStack())
+            {
+                if (GameLogicService::canMatch(card, stock))
+                {
+                    return false;
+                }
+            }
+            for (const CardModel& stock : gameModel.getSpareCardStack())
+            {
+                if (GameLogicService::canMatch(card, stock))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // 从头构建紧凑状态的哈希，与模型增量维护的哈希比较
+    bool hashesMatchRebuilt(const GameModel& gameModel)
+    {
+        PackedGameState state;
+        if (!PackedGameState::fromGameModel(gameModel, state))
+        {
+            return false;
+        }
+        return state.getHash() == gameModel.getHash() && state.getCanonicalHash() == gameModel.getCanonicalHash();
+    }
+
+    void dealGame(GameModel& gameModel, TableauLayout::Kind layout, uint64_t seed, int mainCount, int bottomCount, int spareCount)
+    {
+        gameModel.setLayout(TableauLayout::getLayout(layout));
+        gameModel.reset();
+        CardGeneratorService::generateInitialCards(gameModel, seed, mainCount, bottomCount, spareCount);
+    }
+
+    // ------------------------------------------------------------------
+    // 测试用例
+    // ------------------------------------------------------------------
+
+    void testMoveJournalPackRoundTrip()
+    {
+        const GameMove::Type types[] = { GameMove::PLAY_MAIN, GameMove::SPARE_TO_BOTTOM, GameMove::BOTTOM_TO_SPARE };
+        const int cardIds[] = { 0, 1, 511, 4096, MoveJournal::MAX_CARD_ID };
+        const int mainIndices[] = { 0, 1, 27, MoveJournal::MAX_MAIN_INDEX };
+        for (GameMove::Type type : types)
+        {
+            for (int cardId : cardIds)
+            {
+                for (int mainIndex : mainIndices)
+                {
+                    MoveJournal::Entry entry = MoveJournal::pack(type, cardId, mainIndex);
+                    CHECK(MoveJournal::getType(entry) == type);
+                    CHECK(MoveJournal::getCardId(entry) == cardId);
+                    CHECK(MoveJournal::getMainIndex(entry) == mainIndex);
+                    GameMove move = MoveJournal::toMove(entry);
+                    CHECK(move.type == type && move.cardId == cardId);
+                }
+            }
+        }
+    }
+
+    void testMoveJournalCursor()
+    {
+        MoveJournal journal;
+        CHECK(!journal.canUndo() && !journal.canRedo());
+
+        journal.record(MoveJournal::pack(GameMove::PLAY_MAIN, 1, 0));
+        journal.record(MoveJournal::pack(GameMove::SPARE_TO_BOTTOM, 2, 0));
+        journal.record(MoveJournal::pack(GameMove::PLAY_MAIN, 3, 5));
+        CHECK(journal.getAppliedCount() == 3);
+
+        CHECK(MoveJournal::getCardId(journal.popUndo()) == 3);
+        CHECK(MoveJournal::getCardId(journal.popUndo()) == 2);
+        CHECK(journal.canRedo());
+        CHECK(MoveJournal::getCardId(journal.popRedo()) == 2);
+
+        // 撤销后记录新操作会丢弃可重做部分
+        journal.record(MoveJournal::pack(GameMove::BOTTOM_TO_SPARE, 4, 0));
+        CHECK(!journal.canRedo());
+        CHECK(journal.getAppliedCount() == 3);
+        CHECK(MoveJournal::getCardId(journal.getEntry(2)) == 4);
+    }
+
+    void testPackedCardRoundTrip()
+    {
+        const CardModel::Suit suits[] = { CardModel::HEARTS, CardModel::DIAMONDS, CardModel::CLUBS, CardModel::SPADES };
+        const int ids[] = { 0, 1, 52, 255, PackedCard::MAX_ID };
+        for (CardModel::Suit suit : suits)
+        {
+            for (int value = CardModel::ACE; value <= CardModel::KING; value++)
+            {
+                for (int id : ids)
+                {
+                    for (int faceUp = 0; faceUp < 2; faceUp++)
+                    {
+                        CardModel::Value cardValue = static_cast<CardModel::Value>(value);
+                        PackedCard packed(suit, cardValue, faceUp != 0, id);
+                        CHECK(packed.getSuit() == suit);
+                        CHECK(packed.getValue() == cardValue);
+                        CHECK(packed.isFaceUp() == (faceUp != 0));
+                        CHECK(packed.getId() == id);
+                        CHECK(PackedCard::fromBits(packed.getBits()).getBits() == packed.getBits());
+
+                        CardModel card = packed.toCardModel();
+                        CHECK(card.getSuit() == suit && card.getValue() == cardValue);
+                        CHECK(card.isFaceUp() == (faceUp != 0) && card.getId() == id);
+                        CHECK(PackedCard(card).getBits() == packed.getBits());
+
+                        packed.setFaceUp(faceUp == 0);
+                        CHECK(packed.isFaceUp() == (faceUp == 0) && packed.getId() == id && packed.getValue() == cardValue);
+                    }
+                }
+            }
+        }
+    }
+
+    void testRankIndex()
+    {
+        RankIndex index;
+        CHECK(index.getMask() == 0);
+        index.add(CardModel::ACE);
+        index.add(CardModel::ACE);
+        index.add(CardModel::KING);
+        index.add(0);       // 越界忽略
+        index.add(14);
+        CHECK(index.getMask() == ((1u << 1) | (1u << 13)));
+        CHECK(index.getCount(CardModel::ACE) == 2);
+
+        index.remove(CardModel::ACE);
+        CHECK(index.getMask() & (1u << 1));
+        index.remove(CardModel::ACE);
+        CHECK(!(index.getMask() & (1u << 1)));
+        index.remove(CardModel::ACE);   // 张数为0时忽略
+        CHECK(index.getCount(CardModel::ACE) == 0);
+
+        // A 与 K 不相邻：相邻掩码只保留 1-13
+        CHECK(RankIndex::getNeighbours(1u << 1) == (1u << 2));
+        CHECK(RankIndex::getNeighbours(1u << 13) == (1u << 12));
+        CHECK(RankIndex::getNeighbours((1u << 5) | (1u << 7)) == ((1u << 4) | (1u << 6) | (1u << 8)));
+    }
+
+    void testApplyUndoRedoRestoresHash()
+    {
+        const TableauLayout::Kind layouts[] = { TableauLayout::FLAT, TableauLayout::TRI_PEAKS, TableauLayout::PYRAMID };
+        const int mainCounts[] = { 9, 28, 28 };
+        RandomGenerator rng(TEST_SEED, 7);
+        GameModel gameModel;
+        std::vector<GameMove> legal;
+        std::vector<uint64_t> hashes;
+
+        for (int layoutIndex = 0; layoutIndex < 3; layoutIndex++)
+        {
+            for (uint64_t game = 0; game < 50; game++)
+            {
+                dealGame(gameModel, layouts[layoutIndex], RandomGenerator::deriveSeed(TEST_SEED, game),
+                         mainCounts[layoutIndex], 1, 23);
+                const uint64_t startHash = gameModel.getHash();
+                const uint64_t startCanonical = gameModel.getCanonicalHash();
+                const size_t startMain = gameModel.getMainCardCount();
+                CHECK(hashesMatchRebuilt(gameModel));
+
+                // 随机执行一段合法操作，逐步记录哈希
+                hashes.clear();
+                for (int step = 0; step < 60; step++)
+                {
+                    collectLegalMoves(gameModel, legal);
+                    if (legal.empty())
+                    {
+                        break;
+                    }
+                    const GameMove& move = legal[rng.nextBounded(static_cast<uint32_t>(legal.size()))];
+                    CHECK(gameModel.applyMove(move));
+                    hashes.push_back(gameModel.getHash());
+                    CHECK(hashesMatchRebuilt(gameModel));
+                }
+                const uint64_t endHash = gameModel.getHash();
+                const uint64_t endCanonical = gameModel.getCanonicalHash();
+
+                // 全部撤销：每一步回到执行前的哈希，最终回到开局
+                for (size_t i = hashes.size(); i > 0; i--)
+                {
+                    CHECK(gameModel.getHash() == hashes[i - 1]);
+                    CHECK(gameModel.undoMove());
+                }
+                CHECK(!gameModel.canUndo());
+                CHECK(gameModel.getHash() == startHash);
+                CHECK(gameModel.getCanonicalHash() == startCanonical);
+                CHECK(static_cast<size_t>(gameModel.getMainCardCount()) == startMain);
+                CHECK(hashesMatchRebuilt(gameModel));
+
+                // 全部重做：回到撤销前的终局
+                for (size_t i = 0; i < hashes.size(); i++)
+                {
+                    CHECK(gameModel.redoMove());
+                    CHECK(gameModel.getHash() == hashes[i]);
+                }
+                CHECK(!gameModel.canRedo());
+                CHECK(gameModel.getHash() == endHash);
+                CHECK(gameModel.getCanonicalHash() == endCanonical);
+                CHECK(hashesMatchRebuilt(gameModel));
+            }
+        }
+    }
+
+    void testApplyMoveRejectsInvalid()
+    {
+        GameModel gameModel;
+        dealGame(gameModel, TableauLayout::FLAT, TEST_SEED, 9, 1, 2);
+        const uint64_t hash = gameModel.getHash();
+
+        CHECK(!gameModel.applyMove(GameMove(GameMove::PLAY_MAIN, -1)));
+        CHECK(!gameModel.applyMove(GameMove(GameMove::PLAY_MAIN, MoveJournal::MAX_CARD_ID + 1)));
+        // 备用/底牌操作只作用于栈顶
+        const std::vector<CardModel>& spare = gameModel.getSpareCardStack();
+        CHECK(!gameModel.applyMove(GameMove(GameMove::SPARE_TO_BOTTOM, spare.front().getId())));
+        CHECK(!gameModel.canUndo());
+        CHECK(gameModel.getHash() == hash);
+    }
+
+    void testGameOverRankMasks()
+    {
+        // 平铺牌阵：主牌 5，底牌 K，备用区为空 -> 死局
+        GameModel gameModel;
+        gameModel.setLayout(TableauLayout::getLayout(TableauLayout::FLAT));
+        gameModel.addToMainStack(CardModel(CardModel::HEARTS, CardModel::FIVE, 1, 0, 0));
+        gameModel.addToBottomStack(CardModel(CardModel::SPADES, CardModel::KING, 2));
+        CHECK(gameModel.getUncoveredRankMask() == (1u << 5));
+        CHECK(gameModel.getStockRankMask() == (1u << 13));
+        CHECK(gameModel.isGameOver());
+        CHECK(!gameModel.isGameWon());
+
+        // 备用区压在底下的 6 也能翻到底牌栈顶 -> 不再是死局
+        gameModel.addToSpareStack(CardModel(CardModel::CLUBS, CardModel::SIX, 3));
+        gameModel.addToSpareStack(CardModel(CardModel::CLUBS, CardModel::QUEEN, 4));
+        CHECK(gameModel.getStockRankMask() == ((1u << 6) | (1u << 12) | (1u << 13)));
+        CHECK(!gameModel.isGameOver());
+
+        // A 与 K 不相邻
+        GameModel wrap;
+        wrap.setLayout(TableauLayout::getLayout(TableauLayout::FLAT));
+        wrap.addToMainStack(CardModel(CardModel::HEARTS, CardModel::ACE, 1, 0, 0));
+        wrap.addToBottomStack(CardModel(CardModel::SPADES, CardModel::KING, 2));
+        CHECK(wrap.isGameOver());
+
+        // 有覆盖的牌阵：掩码只统计未被覆盖的主牌，随机对局中逐步与逐张比较的结果一致
+        RandomGenerator rng(TEST_SEED, 11);
+        std::vector<GameMove> legal;
+        const TableauLayout::Kind layouts[] = { TableauLayout::TRI_PEAKS, TableauLayout::PYRAMID };
+        for (TableauLayout::Kind layout : layouts)
+        {
+            for (uint64_t game = 0; game < 100; game++)
+            {
+                dealGame(gameModel, layout, RandomGenerator::deriveSeed(TEST_SEED + 1, game), 28, 1, 5);
+                for (int step = 0; step < 40; step++)
+                {
+                    uint16_t uncovered = 0;
+                    for (const CardModel& card : gameModel.getMainCardStack())
+                    {
+                        if (gameModel.isCardClickable(card))
+                        {
+                            uncovered |= static_cast<uint16_t>(1u << card.getValue());
+                        }
+                    }
+                    CHECK(gameModel.getUncoveredRankMask() == uncovered);
+                    CHECK(gameModel.isGameOver() == isGameOverByScan(gameModel));
+
+                    collectLegalMoves(gameModel, legal);
+                    if (legal.empty())
+                    {
+                        break;
+                    }
+                    gameModel.applyMove(legal[rng.nextBounded(static_cast<uint32_t>(legal.size()))]);
+                }
+                CHECK(gameModel.isGameOver() == isGameOverByScan(gameModel));
+            }
+        }
+    }
+
+    void testSolverNodeLimit()
+    {
+        GameModel gameModel;
+        const long long limits[] = { 1, 2, 7, 50, 1000 };
+        for (uint64_t game = 0; game < 40; game++)
+        {
+            dealGame(gameModel, TableauLayout::PYRAMID, RandomGenerator::deriveSeed(TEST_SEED + 2, game), 28, 1, 23);
+            SolverService::Result full = SolverService::solve(gameModel);
+            CHECK(full.status != SolverService::Result::UNKNOWN);
+
+            for (long long maxNodes : limits)
+            {
+                SolverService::Limits solverLimits;
+                solverLimits.maxNodes = maxNodes;
+                SolverService::Result limited = SolverService::solve(gameModel, solverLimits);
+                CHECK(limited.nodes <= maxNodes);
+                if (limited.status == SolverService::Result::UNKNOWN)
+                {
+                    // 只有达到上限才会中止
+                    CHECK(limited.nodes == maxNodes);
+                    CHECK(full.nodes > maxNodes);
+                }
+                else
+                {
+                    // 上限内得出的结论与不限节点时一致
+                    CHECK(limited.status == full.status);
+                    CHECK(limited.nodes == full.nodes);
+                }
+            }
+
+            // 解法可以在模型上逐步执行并清空主牌区
+            if (full.status == SolverService::Result::WINNABLE)
+            {
+                for (const GameMove& move : full.witness)
+                {
+                    CHECK(gameModel.applyMove(move));
+                }
+                CHECK(gameModel.isGameWon());
+            }
+        }
+
+        // 已取消的求解立即在第一次检查时中止
+        std::atomic<bool> cancelled(true);
+        SolverService::Limits cancelLimits;
+        cancelLimits.maxNodes = 1;
+        cancelLimits.cancelFlag = &cancelled;
+        dealGame(gameModel, TableauLayout::PYRAMID, TEST_SEED, 28, 1, 23);
+        SolverService::Result result = SolverService::solve(gameModel, cancelLimits);
+        CHECK(result.nodes <= 1);
+        CHECK(result.status == SolverService::Result::UNKNOWN || result.status == SolverService::Result::WINNABLE);
+    }
+
+    struct TestCase
+    {
+        const char* name;
+        void (*run)();
+    };
+
+    const TestCase TEST_CASES[] = {
+        { "MoveJournal pack/unpack", testMoveJournalPackRoundTrip },
+        { "MoveJournal cursor", testMoveJournalCursor },
+        { "PackedCard round trip", testPackedCardRoundTrip },
+        { "RankIndex", testRankIndex },
+        { "GameModel apply/undo/redo hash", testApplyUndoRedoRestoresHash },
+        { "GameModel rejects invalid moves", testApplyMoveRejectsInvalid },
+        { "GameModel isGameOver rank masks", testGameOverRankMasks },
+        { "SolverService node limit", testSolverNodeLimit },
+    };
+}
+
+int main()
+{
+    int failedCases = 0;
+    for (const TestCase& testCase : TEST_CASES)
+    {
+        int failuresBefore = g_failures;
+        testCase.run();
+        bool passed = g_failures == failuresBefore;
+        failedCases += passed ? 0 : 1;
+        std::printf("[%s] %s\n", passed ? "PASS" : "FAIL", testCase.name);
+    }
+    std::printf("%d checks, %d failed, %d of %d cases failed\n", g_checks, g_failures, failedCases,
+                static_cast<int>(sizeof(TEST_CASES) / sizeof(TEST_CASES[0])));
+    return g_failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
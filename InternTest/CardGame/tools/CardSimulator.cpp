@@ -0,0 +1,497 @@
+/**
+ * 无界面对局模拟器
+ * 职责：脱离cocos2d-x引擎，批量驱动 GameModel / CardGeneratorService / MoveGeneratorService
+ *       进行随机、贪心或按求解器解法的对局，统计每秒对局数、每秒步数和每局内存分配次数
+ *       随机/贪心对局同步维护一份 PackedGameState，可匹配主牌由 getPlayableMainSlots 一次求出
+ * 自检：--verify-hashes 1 时每步经 applyMove 执行，并在执行后、撤销/重做往返后
+ *       将 GameModel 增量维护的哈希与从头重算的结果、以及同步维护的 PackedGameState 的哈希核对，
+ *       不一致时以非零状态退出
+ *
+ * 用法：card_simulator [--games N] [--policy greedy|random|solver] [--seed S]
+ *                      [--main N] [--bottom N] [--spare N] [--max-moves N]
+ *                      [--layout flat|tripeaks|pyramid] [--max-nodes N] [--verify-hashes 0|1]
+ */
+
+#include "models/GameModel.h"
+#include "models/ZobristKeys.h"
+#include "services/CardGeneratorService.h"
+#include "services/MoveGeneratorService.h"
+#include "services/SolverService.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <new>
+#include <string>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+// 内存分配计数：替换全局 operator new，统计对局过程中的堆分配次数
+// ---------------------------------------------------------------------------
+namespace
+{
+    std::atomic<unsigned long long> g_allocCount(0);
+}
+
+void* operator new(std::size_t size)
+{
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    void* ptr = std::malloc(size ? size : 1);
+    if (!ptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+    // 对局策略
+    enum Policy {
+        GREEDY,     // 优先消除主牌，否则翻备用牌，无牌可翻即结束
+        RANDOM,     // 在所有合法操作中均匀随机选择
+        SOLVER      // 先求解牌局，可解时按解法操作
+    };
+
+    // 模拟参数（缺省值与 GameConfig::GameSettings 保持一致）
+    struct SimOptions
+    {
+        long long games = 1000000;
+        Policy policy = GREEDY;
+        uint64_t seed = 20240601u;  // 第 i 局的牌局种子为 deriveSeed(seed, i)，任一局都可单独复现
+        int mainCardCount = 9;
+        int bottomCardCount = 1;
+        int spareCardCount = 2;
+        int maxMoves = 200;         // 单局步数上限，避免底牌/备用牌来回切换导致死循环
+        TableauLayout::Kind layout = TableauLayout::FLAT;   // 有槽位的牌阵主牌数不超过槽位数
+        long long maxNodes = 0;     // 单局求解节点上限（solver 策略），0表示不限
+        bool verifyHashes = false;  // 逐步核对增量哈希（较慢，不计入性能统计的参考值）
+    };
+
+    // 模拟统计
+    struct SimStats
+    {
+        long long games = 0;
+        long long wins = 0;
+        long long moves = 0;
+        unsigned long long allocs = 0;
+        double seconds = 0.0;
+        long long solverNodes = 0;      // 求解器统计（仅 solver 策略）
+        double solverMs = 0.0;
+        size_t solverPeakMemory = 0;
+        long long hashChecks = 0;       // 哈希核对次数（仅 --verify-hashes）
+        long long hashMismatches = 0;
+    };
+
+    void printUsage(const char* exe)
+    {
+        std::printf("Usage: %s [--games N] [--policy greedy|random|solver] [--seed S]\n"
+                    "          [--main N] [--bottom N] [--spare N] [--max-moves N]\n"
+                    "          [--layout flat|tripeaks|pyramid] [--max-nodes N] [--verify-hashes 0|1]\n", exe);
+    }
+
+    static const char* const LAYOUT_NAMES[] = { "flat", "tripeaks", "pyramid" };
+
+    // 按名称解析牌阵布局
+    bool parseLayout(const char* value, TableauLayout::Kind& outKind)
+    {
+        for (int kind = TableauLayout::FLAT; kind <= TableauLayout::PYRAMID; kind++)
+        {
+            if (std::strcmp(value, LAYOUT_NAMES[kind]) == 0)
+            {
+                outKind = static_cast<TableauLayout::Kind>(kind);
+                return true;
+            }
+        }
+        std::fprintf(stderr, "Unknown layout: %s\n", value);
+        return false;
+    }
+
+    bool parseOptions(int argc, char** argv, SimOptions& options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string arg = argv[i];
+            if (arg == "--help" || arg == "-h")
+            {
+                return false;
+            }
+            if (i + 1 >= argc)
+            {
+                std::fprintf(stderr, "Missing value for %s\n", arg.c_str());
+                return false;
+            }
+
+            const char* value = argv[++i];
+            if (arg == "--games")
+            {
+                options.games = std::atoll(value);
+            }
+            else if (arg == "--policy")
+            {
+                if (std::strcmp(value, "greedy") == 0)
+                {
+                    options.policy = GREEDY;
+                }
+                else if (std::strcmp(value, "random") == 0)
+                {
+                    options.policy = RANDOM;
+                }
+                else if (std::strcmp(value, "solver") == 0)
+                {
+                    options.policy = SOLVER;
+                }
+                else
+                {
+                    std::fprintf(stderr, "Unknown policy: %s\n", value);
+                    return false;
+                }
+            }
+            else if (arg == "--seed")
+            {
+                options.seed = std::strtoull(value, nullptr, 10);
+            }
+            else if (arg == "--main")
+            {
+                options.mainCardCount = std::atoi(value);
+            }
+            else if (arg == "--bottom")
+            {
+                options.bottomCardCount = std::atoi(value);
+            }
+            else if (arg == "--spare")
+            {
+                options.spareCardCount = std::atoi(value);
+            }
+            else if (arg == "--max-moves")
+            {
+                options.maxMoves = std::atoi(value);
+            }
+            else if (arg == "--max-nodes")
+            {
+                options.maxNodes = std::atoll(value);
+            }
+            else if (arg == "--verify-hashes")
+            {
+                options.verifyHashes = std::atoi(value) != 0;
+            }
+            else if (arg == "--layout")
+            {
+                if (!parseLayout(value, options.layout))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                std::fprintf(stderr, "Unknown option: %s\n", arg.c_str());
+                return false;
+            }
+        }
+        // 随机/贪心对局同步维护紧凑状态，卡牌总数不能超出其单区容量
+        int totalCards = options.mainCardCount + options.bottomCardCount + options.spareCardCount;
+        if (options.mainCardCount < 0 || options.bottomCardCount < 0 || options.spareCardCount < 0
+            || totalCards > PackedGameState::MAX_CARDS)
+        {
+            std::fprintf(stderr, "Card counts must be non-negative and total at most %d\n", PackedGameState::MAX_CARDS);
+            return false;
+        }
+        return options.games > 0 && options.maxMoves > 0;
+    }
+
+    // 从头计算模型的两个哈希（与 GameModel 的增量维护相互独立）
+    void computeHashes(const GameModel& gameModel, uint64_t& outHash, uint64_t& outCanonicalHash)
+    {
+        outHash = 0;
+        outCanonicalHash = 0;
+        const std::vector<CardModel>* stacks[] = {
+            &gameModel.getMainCardStack(), &gameModel.getBottomCardStack(), &gameModel.getSpareCardStack()
+        };
+        for (int zone = 0; zone < ZobristKeys::ZONE_COUNT; zone++)
+        {
+            const std::vector<CardModel>& stack = *stacks[zone];
+            for (size_t i = 0; i < stack.size(); i++)
+            {
+                const CardModel& card = stack[i];
+                int position = zone == 0 ? card.getGridIndex() : static_cast<int>(i);
+                outHash ^= ZobristKeys::getCardKey(zone, position, card.getSuit(), card.getValue());
+                outCanonicalHash ^= ZobristKeys::getRankKey(zone, position, card.getValue());
+            }
+        }
+    }
+
+    // 核对增量哈希与重算结果，并与期望值比较
+    bool hashesMatch(const GameModel& gameModel, uint64_t expectedHash, uint64_t expectedCanonicalHash,
+                     SimStats& stats)
+    {
+        uint64_t hash = 0;
+        uint64_t canonicalHash = 0;
+        computeHashes(gameModel, hash, canonicalHash);
+        stats.hashChecks++;
+        return hash == gameModel.getHash() && canonicalHash == gameModel.getCanonicalHash()
+               && hash == expectedHash && canonicalHash == expectedCanonicalHash;
+    }
+
+    /**
+     * 执行一步操作
+     * 校验模式下经 applyMove 记入日志，核对执行后的哈希，再做一次撤销/重做往返，
+     * 撤销后须回到执行前的哈希，重做后须回到执行后的哈希
+     */
+    void playMove(GameModel& gameModel, GameMove::Type type, int cardId, const SimOptions& options, SimStats& stats)
+    {
+        if (!options.verifyHashes)
+        {
+            switch (type)
+            {
+                case GameMove::PLAY_MAIN: gameModel.moveMainToBottom(cardId); break;
+                case GameMove::SPARE_TO_BOTTOM: gameModel.moveSpareToBottom(); break;
+                case GameMove::BOTTOM_TO_SPARE: gameModel.moveBottomToSpare(); break;
+            }
+            return;
+        }
+
+        uint64_t hashBefore = gameModel.getHash();
+        uint64_t canonicalBefore = gameModel.getCanonicalHash();
+        gameModel.applyMove(GameMove(type, cardId));
+        uint64_t hashAfter = 0;
+        uint64_t canonicalAfter = 0;
+        computeHashes(gameModel, hashAfter, canonicalAfter);
+
+        bool ok = hashesMatch(gameModel, hashAfter, canonicalAfter, stats);
+        gameModel.undoMove();
+        ok = hashesMatch(gameModel, hashBefore, canonicalBefore, stats) && ok;
+        gameModel.redoMove();
+        ok = hashesMatch(gameModel, hashAfter, canonicalAfter, stats) && ok;
+        if (!ok)
+        {
+            stats.hashMismatches++;
+        }
+    }
+
+    // 收集当前所有可匹配的主牌在紧凑状态主牌区中的下标
+    void collectMatchableSlots(const PackedGameState& state, std::vector<int>& slots)
+    {
+        slots.clear();
+        uint64_t playable = MoveGeneratorService::getPlayableMainSlots(state);
+        while (playable)
+        {
+            slots.push_back(MoveGeneratorService::lowestSlot(playable));
+            playable &= playable - 1;
+        }
+    }
+
+    // 同时在模型和紧凑状态上执行一步操作（mainIndex 为打出主牌时该牌在紧凑状态主牌区中的下标）
+    void playMirroredMove(GameModel& gameModel, PackedGameState& state, GameMove::Type type, int mainIndex,
+                          const SimOptions& options, SimStats& stats)
+    {
+        switch (type)
+        {
+            case GameMove::PLAY_MAIN:
+                playMove(gameModel, type, state.getId(PackedGameState::MAIN, mainIndex), options, stats);
+                state.moveMainToBottom(mainIndex);
+                break;
+            case GameMove::SPARE_TO_BOTTOM:
+                playMove(gameModel, type, gameModel.getTopSpareCard()->getId(), options, stats);
+                state.moveSpareToBottom();
+                break;
+            case GameMove::BOTTOM_TO_SPARE:
+                playMove(gameModel, type, gameModel.getTopBottomCard()->getId(), options, stats);
+                state.moveBottomToSpare();
+                break;
+        }
+
+        // 两份状态的哈希取值一致（见 GameModel），校验模式下一并核对
+        if (options.verifyHashes)
+        {
+            stats.hashChecks++;
+            if (state.getHash() != gameModel.getHash() || state.getCanonicalHash() != gameModel.getCanonicalHash())
+            {
+                stats.hashMismatches++;
+            }
+        }
+    }
+
+    // 求解牌局并按解法操作，返回执行的步数
+    int playSolvedGame(GameModel& gameModel, const SimOptions& options, SimStats& stats)
+    {
+        SolverService::Limits limits;
+        limits.maxNodes = options.maxNodes;
+        SolverService::Result result = SolverService::solve(gameModel, limits);
+        stats.solverNodes += result.nodes;
+        stats.solverMs += result.elapsedMs;
+        stats.solverPeakMemory = std::max(stats.solverPeakMemory, result.peakMemoryBytes);
+
+        for (const auto& move : result.witness)
+        {
+            playMove(gameModel, move.type, move.cardId, options, stats);
+        }
+        return static_cast<int>(result.witness.size());
+    }
+
+    // 进行一局对局，返回执行的步数
+    int playGame(GameModel& gameModel, const SimOptions& options, RandomGenerator& policyRng,
+                 std::vector<int>& matchable, SimStats& stats)
+    {
+        // 卡牌总数已在解析参数时检查，转换不会失败
+        PackedGameState state;
+        PackedGameState::fromGameModel(gameModel, state);
+
+        int moves = 0;
+        while (moves < options.maxMoves && gameModel.getMainCardCount() > 0)
+        {
+            collectMatchableSlots(state, matchable);
+
+            if (options.policy == GREEDY)
+            {
+                if (!matchable.empty())
+                {
+                    playMirroredMove(gameModel, state, GameMove::PLAY_MAIN, matchable.front(), options, stats);
+                }
+                else if (!gameModel.getSpareCardStack().empty())
+                {
+                    playMirroredMove(gameModel, state, GameMove::SPARE_TO_BOTTOM, 0, options, stats);
+                }
+                else
+                {
+                    break;
+                }
+            }
+            else
+            {
+                // 合法操作：各张可匹配主牌 + 备用牌翻到底牌区 + 底牌退回备用区
+                bool canDrawSpare = !gameModel.getSpareCardStack().empty();
+                bool canReturnBottom = gameModel.hasBottomCard();
+                int total = static_cast<int>(matchable.size()) + (canDrawSpare ? 1 : 0) + (canReturnBottom ? 1 : 0);
+                if (total == 0)
+                {
+                    break;
+                }
+
+                int choice = static_cast<int>(policyRng.nextBounded(static_cast<uint32_t>(total)));
+                if (choice < static_cast<int>(matchable.size()))
+                {
+                    playMirroredMove(gameModel, state, GameMove::PLAY_MAIN, matchable[choice], options, stats);
+                }
+                else if (canDrawSpare && choice == static_cast<int>(matchable.size()))
+                {
+                    playMirroredMove(gameModel, state, GameMove::SPARE_TO_BOTTOM, 0, options, stats);
+                }
+                else
+                {
+                    playMirroredMove(gameModel, state, GameMove::BOTTOM_TO_SPARE, 0, options, stats);
+                }
+            }
+            moves++;
+        }
+        return moves;
+    }
+
+    SimStats runSimulation(const SimOptions& options)
+    {
+        SimStats stats;
+        GameModel gameModel;
+        gameModel.setLayout(TableauLayout::getLayout(options.layout));
+        RandomGenerator policyRng(options.seed, 1);  // 与发牌使用不同的流
+        std::vector<int> matchable;
+        matchable.reserve(options.mainCardCount);
+
+        unsigned long long allocsBefore = g_allocCount.load(std::memory_order_relaxed);
+        auto start = std::chrono::steady_clock::now();
+
+        for (long long i = 0; i < options.games; i++)
+        {
+            // 与 GameController::startNewGame 相同：复用模型并重新发牌
+            gameModel.reset();
+            CardGeneratorService::generateInitialCards(gameModel, RandomGenerator::deriveSeed(options.seed, i),
+                                                       options.mainCardCount, options.bottomCardCount,
+                                                       options.spareCardCount);
+            if (options.verifyHashes && !hashesMatch(gameModel, gameModel.getHash(), gameModel.getCanonicalHash(), stats))
+            {
+                stats.hashMismatches++;
+            }
+
+            if (options.policy == SOLVER)
+            {
+                stats.moves += playSolvedGame(gameModel, options, stats);
+            }
+            else
+            {
+                stats.moves += playGame(gameModel, options, policyRng, matchable, stats);
+            }
+            if (gameModel.getMainCardCount() == 0)
+            {
+                stats.wins++;
+            }
+        }
+
+        auto end = std::chrono::steady_clock::now();
+        stats.games = options.games;
+        stats.allocs = g_allocCount.load(std::memory_order_relaxed) - allocsBefore;
+        stats.seconds = std::chrono::duration<double>(end - start).count();
+        return stats;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    SimOptions options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    SimStats stats = runSimulation(options);
+
+    double seconds = stats.seconds > 0.0 ? stats.seconds : 1e-9;
+    static const char* const POLICY_NAMES[] = { "greedy", "random", "solver" };
+    std::printf("policy        : %s\n", POLICY_NAMES[options.policy]);
+    std::printf("deal          : main=%d bottom=%d spare=%d layout=%s seed=%llu\n",
+                options.mainCardCount, options.bottomCardCount, options.spareCardCount, LAYOUT_NAMES[options.layout],
+                static_cast<unsigned long long>(options.seed));
+    std::printf("games         : %lld (won %lld, %.2f%%)\n",
+                stats.games, stats.wins, 100.0 * stats.wins / stats.games);
+    std::printf("moves         : %lld (%.2f per game)\n",
+                stats.moves, static_cast<double>(stats.moves) / stats.games);
+    std::printf("elapsed       : %.3f s\n", stats.seconds);
+    std::printf("games/sec     : %.0f\n", stats.games / seconds);
+    std::printf("moves/sec     : %.0f\n", stats.moves / seconds);
+    std::printf("allocs/game   : %.2f\n", static_cast<double>(stats.allocs) / stats.games);
+    if (options.policy == SOLVER)
+    {
+        double solverSeconds = stats.solverMs > 0.0 ? stats.solverMs / 1000.0 : 1e-9;
+        std::printf("solver nodes  : %lld (%.1f per deal)\n",
+                    stats.solverNodes, static_cast<double>(stats.solverNodes) / stats.games);
+        std::printf("solver time   : %.2f us per deal\n", stats.solverMs * 1000.0 / stats.games);
+        std::printf("nodes/sec     : %.0f\n", stats.solverNodes / solverSeconds);
+        std::printf("peak memory   : %zu bytes\n", stats.solverPeakMemory);
+    }
+    if (options.verifyHashes)
+    {
+        std::printf("hash checks   : %lld (%lld mismatches)\n", stats.hashChecks, stats.hashMismatches);
+        if (stats.hashMismatches > 0)
+        {
+            std::fprintf(stderr, "Hash self-check failed\n");
+            return 2;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,332 @@
+/**
+ * 批量牌局分析工具
+ * 职责：用 CardGeneratorService 批量发牌，交给工作窃取线程池并行求解，
+ *       统计可解率、求解节点数、解法步数、翻牌次数和开局可匹配主牌数，
+ *       按规范哈希统计仅花色不同的重复牌局，并输出各工作线程的吞吐量
+ *
+ * 用法：card_deal_analyzer [--deals N] [--threads N] [--grain N] [--seed S]
+ *                          [--main N] [--bottom N] [--spare N] [--csv FILE]
+ *                          [--layout flat|tripeaks|pyramid] [--max-nodes N]
+ */
+
+#include "WorkStealingPool.h"
+#include "models/GameModel.h"
+#include "models/PackedGameState.h"
+#include "services/CardGeneratorService.h"
+#include "services/MoveGeneratorService.h"
+#include "services/SolverService.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // 分析参数（缺省值与 GameConfig::GameSettings 保持一致）
+    struct AnalyzerOptions
+    {
+        long long deals = 1000000;
+        int threads = 0;            // 0 表示使用硬件线程数
+        long long grainSize = 256;  // 单次处理的最大牌局数
+        uint64_t seed = 20240601u;  // 第 i 局的牌局种子为 deriveSeed(seed, i)，结果与线程调度无关
+        int mainCardCount = 9;
+        int bottomCardCount = 1;
+        int spareCardCount = 2;
+        std::string csvPath;        // 非空时输出逐局明细
+        TableauLayout::Kind layout = TableauLayout::FLAT;   // 有槽位的牌阵主牌数不超过槽位数
+        long long maxNodes = 0;     // 单局求解节点上限，0表示不限；超出时计为未知
+    };
+
+    // 单局分析结果
+    struct DealMetrics
+    {
+        long long dealIndex;
+        uint64_t dealSeed;      // 牌局种子，可用于复现该局
+        uint64_t canonicalKey;  // 开局的规范哈希，仅花色不同的牌局相同
+        int status;             // SolverService::Result::Status
+        int nodes;              // 求解节点数
+        int witnessLength;      // 解法步数
+        int stockFlips;         // 解法中底牌/备用牌的翻动次数
+        int initialPlayable;    // 开局可匹配的主牌数
+    };
+
+    // 每个工作线程独占的结果缓冲区，线程之间不共享写入，结束后统一合并
+    struct WorkerBuffer
+    {
+        std::vector<DealMetrics> metrics;
+        GameModel gameModel;    // 复用的发牌模型
+    };
+
+    void printUsage(const char* exe)
+    {
+        std::printf("Usage: %s [--deals N] [--threads N] [--grain N] [--seed S]\n"
+                    "          [--main N] [--bottom N] [--spare N] [--csv FILE]\n"
+                    "          [--layout flat|tripeaks|pyramid] [--max-nodes N]\n", exe);
+    }
+
+    static const char* const LAYOUT_NAMES[] = { "flat", "tripeaks", "pyramid" };
+
+    // 按名称解析牌阵布局
+    bool parseLayout(const char* value, TableauLayout::Kind& outKind)
+    {
+        for (int kind = TableauLayout::FLAT; kind <= TableauLayout::PYRAMID; kind++)
+        {
+            if (std::strcmp(value, LAYOUT_NAMES[kind]) == 0)
+            {
+                outKind = static_cast<TableauLayout::Kind>(kind);
+                return true;
+            }
+        }
+        std::fprintf(stderr, "Unknown layout: %s\n", value);
+        return false;
+    }
+
+    bool parseOptions(int argc, char** argv, AnalyzerOptions& options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string arg = argv[i];
+            if (arg == "--help" || arg == "-h")
+            {
+                return false;
+            }
+            if (i + 1 >= argc)
+            {
+                std::fprintf(stderr, "Missing value for %s\n", arg.c_str());
+                return false;
+            }
+
+            const char* value = argv[++i];
+            if (arg == "--deals")
+            {
+                options.deals = std::atoll(value);
+            }
+            else if (arg == "--threads")
+            {
+                options.threads = std::atoi(value);
+            }
+            else if (arg == "--grain")
+            {
+                options.grainSize = std::atoll(value);
+            }
+            else if (arg == "--seed")
+            {
+                options.seed = std::strtoull(value, nullptr, 10);
+            }
+            else if (arg == "--main")
+            {
+                options.mainCardCount = std::atoi(value);
+            }
+            else if (arg == "--bottom")
+            {
+                options.bottomCardCount = std::atoi(value);
+            }
+            else if (arg == "--spare")
+            {
+                options.spareCardCount = std::atoi(value);
+            }
+            else if (arg == "--csv")
+            {
+                options.csvPath = value;
+            }
+            else if (arg == "--max-nodes")
+            {
+                options.maxNodes = std::atoll(value);
+            }
+            else if (arg == "--layout")
+            {
+                if (!parseLayout(value, options.layout))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                std::fprintf(stderr, "Unknown option: %s\n", arg.c_str());
+                return false;
+            }
+        }
+        return options.deals > 0 && options.grainSize > 0;
+    }
+
+    // 发一局牌并求解
+    DealMetrics analyzeDeal(long long dealIndex, const AnalyzerOptions& options, GameModel& gameModel)
+    {
+        DealMetrics metrics = DealMetrics();
+        metrics.dealIndex = dealIndex;
+        metrics.dealSeed = RandomGenerator::deriveSeed(options.seed, static_cast<uint64_t>(dealIndex));
+
+        gameModel.reset();
+        CardGeneratorService::generateInitialCards(gameModel, metrics.dealSeed, options.mainCardCount,
+                                                   options.bottomCardCount, options.spareCardCount);
+        metrics.canonicalKey = gameModel.getCanonicalHash();
+
+        PackedGameState state;
+        if (!PackedGameState::fromGameModel(gameModel, state))
+        {
+            metrics.status = SolverService::Result::UNKNOWN;
+            return metrics;
+        }
+
+        uint64_t playable = MoveGeneratorService::getPlayableMainSlots(state);
+        while (playable)
+        {
+            playable &= playable - 1;
+            metrics.initialPlayable++;
+        }
+
+        SolverService::Limits limits;
+        limits.maxNodes = options.maxNodes;
+        SolverService::Result result = SolverService::solve(state, limits);
+        metrics.status = result.status;
+        metrics.nodes = static_cast<int>(result.nodes);
+        metrics.witnessLength = static_cast<int>(result.witness.size());
+        for (const auto& move : result.witness)
+        {
+            if (move.type != GameMove::PLAY_MAIN)
+            {
+                metrics.stockFlips++;
+            }
+        }
+        return metrics;
+    }
+
+    bool writeCsv(const std::string& path, const std::vector<DealMetrics>& metrics)
+    {
+        FILE* file = std::fopen(path.c_str(), "w");
+        if (!file)
+        {
+            std::fprintf(stderr, "Cannot open %s\n", path.c_str());
+            return false;
+        }
+        static const char* const STATUS_NAMES[] = { "winnable", "unwinnable", "unknown" };
+        std::fprintf(file, "deal,seed,canonical_key,status,nodes,witness_length,stock_flips,initial_playable\n");
+        for (const auto& item : metrics)
+        {
+            std::fprintf(file, "%lld,%llu,%016llx,%s,%d,%d,%d,%d\n", item.dealIndex,
+                         static_cast<unsigned long long>(item.dealSeed),
+                         static_cast<unsigned long long>(item.canonicalKey), STATUS_NAMES[item.status],
+                         item.nodes, item.witnessLength, item.stockFlips, item.initialPlayable);
+        }
+        std::fclose(file);
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    AnalyzerOptions options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+    if (options.threads <= 0)
+    {
+        options.threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    WorkStealingPool pool(options.threads);
+    std::vector<WorkerBuffer> buffers(pool.getWorkerCount());
+    for (auto& buffer : buffers)
+    {
+        buffer.metrics.reserve(static_cast<size_t>(options.deals / pool.getWorkerCount() + options.grainSize));
+        buffer.gameModel.setLayout(TableauLayout::getLayout(options.layout));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    pool.parallelFor(options.deals, options.grainSize,
+        [&options, &buffers](int workerIndex, const WorkStealingPool::Range& range) {
+            WorkerBuffer& buffer = buffers[workerIndex];
+            for (long long i = range.begin; i < range.end; i++)
+            {
+                buffer.metrics.push_back(analyzeDeal(i, options, buffer.gameModel));
+            }
+        });
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (seconds <= 0.0)
+    {
+        seconds = 1e-9;
+    }
+
+    // 合并各线程结果并按牌局序号排序
+    std::vector<DealMetrics> merged;
+    merged.reserve(static_cast<size_t>(options.deals));
+    for (const auto& buffer : buffers)
+    {
+        merged.insert(merged.end(), buffer.metrics.begin(), buffer.metrics.end());
+    }
+    std::sort(merged.begin(), merged.end(), [](const DealMetrics& a, const DealMetrics& b) {
+        return a.dealIndex < b.dealIndex;
+    });
+
+    long long counts[3] = { 0, 0, 0 };
+    long long totalNodes = 0;
+    long long witnessSteps = 0;
+    long long stockFlips = 0;
+    long long initialPlayable = 0;
+    int maxNodes = 0;
+    for (const auto& item : merged)
+    {
+        counts[item.status]++;
+        totalNodes += item.nodes;
+        maxNodes = std::max(maxNodes, item.nodes);
+        initialPlayable += item.initialPlayable;
+        if (item.status == SolverService::Result::WINNABLE)
+        {
+            witnessSteps += item.witnessLength;
+            stockFlips += item.stockFlips;
+        }
+    }
+
+    // 规范哈希排序后相邻相等即为重复牌局（与之前某一局仅花色不同）
+    std::vector<uint64_t> canonicalKeys;
+    canonicalKeys.reserve(merged.size());
+    for (const auto& item : merged)
+    {
+        canonicalKeys.push_back(item.canonicalKey);
+    }
+    std::sort(canonicalKeys.begin(), canonicalKeys.end());
+    long long duplicates = static_cast<long long>(canonicalKeys.size())
+                           - (std::unique(canonicalKeys.begin(), canonicalKeys.end()) - canonicalKeys.begin());
+
+    long long deals = static_cast<long long>(merged.size());
+    long long winnable = counts[SolverService::Result::WINNABLE];
+    std::printf("deal          : main=%d bottom=%d spare=%d layout=%s seed=%llu\n",
+                options.mainCardCount, options.bottomCardCount, options.spareCardCount, LAYOUT_NAMES[options.layout],
+                static_cast<unsigned long long>(options.seed));
+    std::printf("threads       : %d (grain %lld)\n", pool.getWorkerCount(), options.grainSize);
+    std::printf("deals         : %lld\n", deals);
+    std::printf("winnable      : %lld (%.2f%%)\n", winnable, 100.0 * winnable / deals);
+    std::printf("unwinnable    : %lld\n", counts[SolverService::Result::UNWINNABLE]);
+    std::printf("unknown       : %lld\n", counts[SolverService::Result::UNKNOWN]);
+    std::printf("solver nodes  : %.1f per deal (max %d)\n", static_cast<double>(totalNodes) / deals, maxNodes);
+    std::printf("playable      : %.2f main cards at start\n", static_cast<double>(initialPlayable) / deals);
+    std::printf("duplicates    : %lld deals repeat an earlier deal up to suits\n", duplicates);
+    if (winnable > 0)
+    {
+        std::printf("witness       : %.2f moves, %.2f stock flips per winnable deal\n",
+                    static_cast<double>(witnessSteps) / winnable, static_cast<double>(stockFlips) / winnable);
+    }
+    std::printf("elapsed       : %.3f s\n", seconds);
+    std::printf("deals/sec     : %.0f\n", deals / seconds);
+
+    const std::vector<WorkStealingPool::WorkerStats>& stats = pool.getWorkerStats();
+    for (size_t i = 0; i < stats.size(); i++)
+    {
+        double busy = stats[i].busySeconds > 0.0 ? stats[i].busySeconds : 1e-9;
+        std::printf("worker %-6zu : %lld deals, %lld steals, %.0f deals/sec, %.1f%% busy\n",
+                    i, stats[i].items, stats[i].steals, stats[i].items / busy, 100.0 * stats[i].busySeconds / seconds);
+    }
+
+    if (!options.csvPath.empty() && !writeCsv(options.csvPath, merged))
+    {
+        return 1;
+    }
+    return 0;
+}
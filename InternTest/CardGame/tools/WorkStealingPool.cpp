@@ -0,0 +1,124 @@
+#include "WorkStealingPool.h"
+#include <chrono>
+#include <thread>
+
+WorkStealingPool::WorkStealingPool(int workerCount)
+    : _workerCount(workerCount > 0 ? workerCount : 1),
+      _queues(_workerCount),
+      _stats(_workerCount),
+      _remaining(0)
+{
+}
+
+void WorkStealingPool::parallelFor(long long count, long long grainSize, const RangeFunc& func)
+{
+    if (count <= 0)
+    {
+        return;
+    }
+    if (grainSize <= 0)
+    {
+        grainSize = 1;
+    }
+
+    // 初始时每个线程领取均等的一段
+    for (int i = 0; i < _workerCount; i++)
+    {
+        Range range = { count * i / _workerCount, count * (i + 1) / _workerCount };
+        _queues[i].ranges.clear();
+        if (range.end > range.begin)
+        {
+            _queues[i].ranges.push_back(range);
+        }
+        _stats[i] = WorkerStats();
+    }
+    _remaining.store(count);
+
+    std::vector<std::thread> threads;
+    threads.reserve(_workerCount - 1);
+    for (int i = 1; i < _workerCount; i++)
+    {
+        threads.emplace_back(&WorkStealingPool::workerLoop, this, i, grainSize, std::cref(func));
+    }
+    workerLoop(0, grainSize, func);  // 调用线程作为0号工作线程
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+void WorkStealingPool::workerLoop(int workerIndex, long long grainSize, const RangeFunc& func)
+{
+    // 统计先累加在线程栈上，结束时写回一次：相邻线程的统计项共用缓存行，循环中直接写会造成伪共享
+    WorkerStats stats = WorkerStats();
+    Range range;
+
+    while (_remaining.load(std::memory_order_acquire) > 0)
+    {
+        if (!popLocal(workerIndex, range))
+        {
+            if (!steal(workerIndex, range))
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            stats.steals++;
+        }
+
+        // 过大的区间对半拆分，后半段留给其他线程窃取
+        while (range.end - range.begin > grainSize)
+        {
+            long long middle = range.begin + (range.end - range.begin) / 2;
+            Range upper = { middle, range.end };
+            pushLocal(workerIndex, upper);
+            range.end = middle;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        func(workerIndex, range);
+        stats.busySeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        long long items = range.end - range.begin;
+        stats.items += items;
+        _remaining.fetch_sub(items, std::memory_order_release);
+    }
+    _stats[workerIndex] = stats;
+}
+
+bool WorkStealingPool::popLocal(int workerIndex, Range& range)
+{
+    WorkerQueue& queue = _queues[workerIndex];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.ranges.empty())
+    {
+        return false;
+    }
+    range = queue.ranges.back();
+    queue.ranges.pop_back();
+    return true;
+}
+
+bool WorkStealingPool::steal(int thiefIndex, Range& range)
+{
+    // 从下一个线程开始轮询，窃取队列头部（最大的）区间
+    for (int offset = 1; offset < _workerCount; offset++)
+    {
+        WorkerQueue& queue = _queues[(thiefIndex + offset) % _workerCount];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.ranges.empty())
+        {
+            range = queue.ranges.front();
+            queue.ranges.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingPool::pushLocal(int workerIndex, const Range& range)
+{
+    WorkerQueue& queue = _queues[workerIndex];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.ranges.push_back(range);
+}
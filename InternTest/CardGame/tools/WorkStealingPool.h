@@ -0,0 +1,72 @@
+#ifndef __WORK_STEALING_POOL_H__
+#define __WORK_STEALING_POOL_H__
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/**
+ * 工作窃取线程池
+ * 职责：把 [0, count) 的任务区间分给各工作线程；线程处理自己队列尾部的区间，
+ *       区间过大时对半拆分并把后半段留在队列中供其他线程窃取，
+ *       自己的队列为空时从其他线程队列头部窃取
+ */
+class WorkStealingPool
+{
+public:
+    // 任务区间 [begin, end)
+    struct Range
+    {
+        long long begin;
+        long long end;
+    };
+
+    // 区间处理函数：workerIndex 用于访问该线程私有的结果缓冲区
+    typedef std::function<void(int workerIndex, const Range& range)> RangeFunc;
+
+    // 单个工作线程的统计
+    struct WorkerStats
+    {
+        long long items;        // 处理的任务数
+        long long steals;       // 成功窃取次数
+        double busySeconds;     // 处理任务的耗时
+    };
+
+private:
+    struct WorkerQueue
+    {
+        std::mutex mutex;
+        std::deque<Range> ranges;
+    };
+
+    int _workerCount;
+    std::vector<WorkerQueue> _queues;
+    std::vector<WorkerStats> _stats;
+    std::atomic<long long> _remaining;
+
+public:
+    explicit WorkStealingPool(int workerCount);
+
+    int getWorkerCount() const { return _workerCount; }
+
+    /**
+     * 并行处理 [0, count)，阻塞直到全部完成
+     * @param count 任务总数
+     * @param grainSize 单次处理的最大区间长度
+     * @param func 区间处理函数
+     */
+    void parallelFor(long long count, long long grainSize, const RangeFunc& func);
+
+    // 最近一次 parallelFor 的各线程统计（各线程结束时写入，parallelFor 返回后有效）
+    const std::vector<WorkerStats>& getWorkerStats() const { return _stats; }
+
+private:
+    void workerLoop(int workerIndex, long long grainSize, const RangeFunc& func);
+    bool popLocal(int workerIndex, Range& range);
+    bool steal(int thiefIndex, Range& range);
+    void pushLocal(int workerIndex, const Range& range);
+};
+
+#endif // __WORK_STEALING_POOL_H__
@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+"""
+预解码资源包打包工具
+
+将 Resources/res 下的 PNG 解码为预乘透明度的 RGBA8888 像素，连同索引写入一个二进制资源包，
+运行时 AssetPack 内存映射该文件后直接上传纹理，不再做 PNG 解压。
+已打进卡牌图集的单张图片运行时不会被单独加载，默认不打包（--all 时全部打包）。
+
+文件格式见 Classes/utils/AssetPack.h。指定 --base 时生成增量补丁：只包含与基础包内容哈希或源文件哈希不同的条目，
+补丁的基础版本为基础包的内容版本，运行时只在版本匹配时叠加。
+每个条目记录源 PNG 的大小和 FNV-1a 哈希，源图片被重新生成而资源包未更新时，运行时跳过该条目并解码 PNG。
+
+用法：python3 tools/build_asset_pack.py [--resources Resources] [--output res/assets.pak]
+                                       [--revision N] [--base OLD.pak] [--all]
+"""
+
+import argparse
+import hashlib
+import os
+import re
+import struct
+import sys
+
+from build_atlas import read_png
+
+MAGIC = b"CGPK"
+FORMAT_VERSION = 2
+HEADER_FORMAT = "<4sHHIIIIII"   # magic、格式版本、标志、内容版本、基础版本、条目数、索引偏移、字符串表偏移、字符串表大小
+ENTRY_FORMAT = "<IHHIIIIQIIQ"   # 名称偏移、名称长度、像素格式、宽、高、数据偏移、数据大小、内容哈希、源文件大小、保留、源文件哈希
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+ENTRY_SIZE = struct.calcsize(ENTRY_FORMAT)
+PIXEL_FORMAT_RGBA8888_PREMULTIPLIED = 1
+DATA_ALIGNMENT = 16
+
+ATLAS_PLIST = "res/cards.plist"
+
+
+def premultiply(rows):
+    """按 cocos2d-x 加载 PNG 时的方式预乘透明度：c * (a + 1) >> 8"""
+    pixels = bytearray()
+    for row in rows:
+        line = bytearray(row)
+        for i in range(0, len(line), 4):
+            alpha = line[i + 3]
+            if alpha != 255:
+                line[i] = (line[i] * (alpha + 1)) >> 8
+                line[i + 1] = (line[i + 1] * (alpha + 1)) >> 8
+                line[i + 2] = (line[i + 2] * (alpha + 1)) >> 8
+        pixels += line
+    return bytes(pixels)
+
+
+def content_hash(pixels):
+    return struct.unpack("<Q", hashlib.blake2b(pixels, digest_size=8).digest())[0]
+
+
+def source_hash(data):
+    """64位 FNV-1a，与 AssetPack::computeSourceHash 一致"""
+    value = 0xCBF29CE484222325
+    for byte in bytearray(data):
+        value = ((value ^ byte) * 0x100000001B3) & 0xFFFFFFFFFFFFFFFF
+    return value
+
+
+def atlas_frame_names(resources_dir):
+    """图集 plist 中的帧名（即已打进图集的单张图片路径）"""
+    path = os.path.join(resources_dir, ATLAS_PLIST)
+    if not os.path.isfile(path):
+        return set()
+    with open(path) as f:
+        text = f.read()
+    frames = text.split("<key>metadata</key>")[0]
+    return set(re.findall(r"<key>(res/[^<]+\.png)</key>", frames))
+
+
+def collect_sources(resources_dir, include_all):
+    res_dir = os.path.join(resources_dir, "res")
+    skipped = set() if include_all else atlas_frame_names(resources_dir)
+    names = []
+    for root, _, files in os.walk(res_dir):
+        for entry in files:
+            if entry.lower().endswith(".png"):
+                name = os.path.relpath(os.path.join(root, entry), resources_dir).replace(os.sep, "/")
+                if name not in skipped:
+                    names.append(name)
+    return sorted(names)
+
+
+def read_pack(path):
+    """读取已有资源包，返回 (内容版本, {名称: (内容哈希, 源文件哈希)})"""
+    with open(path, "rb") as f:
+        data = f.read()
+    magic, version, _, revision, _, count, index_offset, strings_offset, _ = \
+        struct.unpack_from(HEADER_FORMAT, data, 0)
+    if magic != MAGIC or version != FORMAT_VERSION:
+        raise ValueError("%s: not a version %d asset pack" % (path, FORMAT_VERSION))
+    hashes = {}
+    for i in range(count):
+        name_offset, name_length, _, _, _, _, _, digest, _, _, source_digest = \
+            struct.unpack_from(ENTRY_FORMAT, data, index_offset + i * ENTRY_SIZE)
+        start = strings_offset + name_offset
+        hashes[data[start:start + name_length].decode("utf-8")] = (digest, source_digest)
+    return revision, hashes
+
+
+def align(value):
+    return (value + DATA_ALIGNMENT - 1) // DATA_ALIGNMENT * DATA_ALIGNMENT
+
+
+def write_pack(path, entries, revision, base_revision):
+    """entries: [(名称, 宽, 高, 像素, 哈希, 源文件大小, 源文件哈希)]"""
+    strings = bytearray()
+    name_offsets = []
+    for name, _, _, _, _, _, _ in entries:
+        encoded = name.encode("utf-8")
+        name_offsets.append((len(strings), len(encoded)))
+        strings += encoded
+
+    index_offset = HEADER_SIZE
+    strings_offset = index_offset + ENTRY_SIZE * len(entries)
+    offset = align(strings_offset + len(strings))
+    data_offsets = []
+    for _, _, _, pixels, _, _, _ in entries:
+        data_offsets.append(offset)
+        offset = align(offset + len(pixels))
+
+    with open(path, "wb") as f:
+        f.write(struct.pack(HEADER_FORMAT, MAGIC, FORMAT_VERSION, 0, revision, base_revision,
+                            len(entries), index_offset, strings_offset, len(strings)))
+        for i, (_, width, height, pixels, digest, source_size, source_digest) in enumerate(entries):
+            f.write(struct.pack(ENTRY_FORMAT, name_offsets[i][0], name_offsets[i][1],
+                                PIXEL_FORMAT_RGBA8888_PREMULTIPLIED, width, height,
+                                data_offsets[i], len(pixels), digest, source_size, 0, source_digest))
+        f.write(strings)
+        for i, (_, _, _, pixels, _, _, _) in enumerate(entries):
+            f.write(b"\0" * (data_offsets[i] - f.tell()))
+            f.write(pixels)
+
+
+def main():
+    script_dir = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description="Pack pre-decoded textures into a binary asset pack.")
+    parser.add_argument("--resources", default=os.path.join(script_dir, "..", "Resources"))
+    parser.add_argument("--output", default="res/assets.pak", help="pack path relative to Resources")
+    parser.add_argument("--revision", type=int, default=None,
+                        help="content revision (default 1, or base revision + 1 for a patch)")
+    parser.add_argument("--base", default=None, help="existing pack; write only the entries that changed")
+    parser.add_argument("--all", action="store_true", help="also pack images already in the card atlas")
+    args = parser.parse_args()
+
+    base_revision, base_hashes = (0, {})
+    if args.base:
+        base_revision, base_hashes = read_pack(args.base)
+    revision = args.revision if args.revision is not None else base_revision + 1
+    if revision <= base_revision:
+        parser.error("revision must be greater than the base revision %d" % base_revision)
+
+    entries = []
+    for name in collect_sources(args.resources, args.all):
+        path = os.path.join(args.resources, name)
+        with open(path, "rb") as f:
+            source = f.read()
+        width, height, rows = read_png(path)
+        pixels = premultiply(rows)
+        digest = content_hash(pixels)
+        source_digest = source_hash(source)
+        if base_hashes.get(name) != (digest, source_digest):
+            entries.append((name, width, height, pixels, digest, len(source), source_digest))
+
+    write_pack(os.path.join(args.resources, args.output), entries, revision, base_revision)
+    kind = "patch on revision %d" % base_revision if args.base else "pack"
+    print("wrote %s (%s, revision %d): %d textures, %d bytes of pixels"
+          % (args.output, kind, revision, len(entries), sum(len(e[3]) for e in entries)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
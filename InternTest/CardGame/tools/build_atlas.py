@@ -0,0 +1,241 @@
+#!/usr/bin/env python3
+"""
+卡牌纹理图集打包工具
+
+将卡牌背景、背面、花色和数字图片打包为一张纹理及 cocos2d-x 可读取的 plist（format 2），
+帧名与原图片相对 Resources 的路径一致（如 res/number/big_red_A.png），
+运行时 ResourceService 先按该路径查 SpriteFrameCache，找不到时回退到单独的图片文件。
+
+只依赖 Python 标准库，支持 8 位、非隔行的 RGB/RGBA PNG。
+
+用法：python3 tools/build_atlas.py [--resources Resources] [--output res/cards] [--max-width 1024]
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+
+# 打包进图集的图片（相对 Resources 目录）
+ATLAS_SOURCES = ["res/card_general.png", "res/card_back.png", "res/suits", "res/number"]
+
+PADDING = 2  # 帧之间的透明间隔，避免线性过滤时相邻帧渗色
+
+
+def read_png(path):
+    """读取 PNG，返回 (宽, 高, RGBA 行列表)"""
+    with open(path, "rb") as f:
+        data = f.read()
+    if not data.startswith(PNG_SIGNATURE):
+        raise ValueError("%s: not a PNG file" % path)
+
+    pos = len(PNG_SIGNATURE)
+    idat = bytearray()
+    width = height = bit_depth = color_type = interlace = None
+    while pos < len(data):
+        length, chunk_type = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if chunk_type == b"IHDR":
+            width, height, bit_depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif chunk_type == b"IDAT":
+            idat += chunk
+        elif chunk_type == b"IEND":
+            break
+
+    if bit_depth != 8 or color_type not in (2, 6) or interlace != 0:
+        raise ValueError("%s: only 8-bit non-interlaced RGB/RGBA PNG is supported" % path)
+
+    channels = 4 if color_type == 6 else 3
+    stride = width * channels
+    raw = zlib.decompress(bytes(idat))
+    rows = []
+    previous = bytearray(stride)
+    offset = 0
+    for _ in range(height):
+        filter_type = raw[offset]
+        line = bytearray(raw[offset + 1:offset + 1 + stride])
+        offset += 1 + stride
+        unfilter(line, previous, filter_type, channels)
+        previous = line
+        if channels == 3:
+            rgba = bytearray(width * 4)
+            for x in range(width):
+                rgba[x * 4:x * 4 + 3] = line[x * 3:x * 3 + 3]
+                rgba[x * 4 + 3] = 255
+            line = rgba
+        rows.append(line)
+    return width, height, rows
+
+
+def unfilter(line, previous, filter_type, bpp):
+    """按 PNG 规范还原一行扫描线"""
+    if filter_type == 0:
+        return
+    for i in range(len(line)):
+        left = line[i - bpp] if i >= bpp else 0
+        up = previous[i]
+        if filter_type == 1:
+            line[i] = (line[i] + left) & 0xFF
+        elif filter_type == 2:
+            line[i] = (line[i] + up) & 0xFF
+        elif filter_type == 3:
+            line[i] = (line[i] + ((left + up) >> 1)) & 0xFF
+        elif filter_type == 4:
+            up_left = previous[i - bpp] if i >= bpp else 0
+            p = left + up - up_left
+            pa, pb, pc = abs(p - left), abs(p - up), abs(p - up_left)
+            predictor = left if pa <= pb and pa <= pc else (up if pb <= pc else up_left)
+            line[i] = (line[i] + predictor) & 0xFF
+        else:
+            raise ValueError("unknown PNG filter type %d" % filter_type)
+
+
+def write_png(path, width, height, pixels):
+    """写出 RGBA PNG（每行使用 0 号过滤器）"""
+    stride = width * 4
+    raw = bytearray()
+    for y in range(height):
+        raw.append(0)
+        raw += pixels[y * stride:(y + 1) * stride]
+
+    def chunk(chunk_type, body):
+        return (struct.pack(">I", len(body)) + chunk_type + body
+                + struct.pack(">I", zlib.crc32(chunk_type + body) & 0xFFFFFFFF))
+
+    with open(path, "wb") as f:
+        f.write(PNG_SIGNATURE)
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 6, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(bytes(raw), 9)))
+        f.write(chunk(b"IEND", b""))
+
+
+def collect_sources(resources_dir):
+    """展开 ATLAS_SOURCES，返回按名称排序的相对路径列表"""
+    names = []
+    for source in ATLAS_SOURCES:
+        full = os.path.join(resources_dir, source)
+        if os.path.isdir(full):
+            for entry in os.listdir(full):
+                if entry.lower().endswith(".png"):
+                    names.append(source.rstrip("/") + "/" + entry)
+        elif os.path.isfile(full):
+            names.append(source)
+        else:
+            raise FileNotFoundError(full)
+    return sorted(names)
+
+
+def next_power_of_two(value):
+    size = 1
+    while size < value:
+        size <<= 1
+    return size
+
+
+def pack(images, max_width):
+    """按高度降序的货架式装箱，返回 ({名称: (x, y)}, 图集宽, 图集高)"""
+    order = sorted(images, key=lambda name: (-images[name][1], -images[name][0], name))
+    positions = {}
+    x = y = shelf_height = 0
+    used_width = 0
+    for name in order:
+        w, h = images[name][0], images[name][1]
+        if w + PADDING > max_width:
+            raise ValueError("%s is wider than the atlas" % name)
+        if x + w + PADDING > max_width:
+            x = 0
+            y += shelf_height
+            shelf_height = 0
+        positions[name] = (x + PADDING, y + PADDING)
+        x += w + PADDING
+        shelf_height = max(shelf_height, h + PADDING)
+        used_width = max(used_width, x)
+    used_height = y + shelf_height + PADDING
+    return positions, next_power_of_two(used_width + PADDING), next_power_of_two(used_height)
+
+
+def write_plist(path, texture_name, frames, atlas_width, atlas_height):
+    lines = [
+        '<?xml version="1.0" encoding="UTF-8"?>',
+        '<!DOCTYPE plist PUBLIC "-//Apple Computer//DTD PLIST 1.0//EN" '
+        '"http://www.apple.com/DTDs/PropertyList-1.0.dtd">',
+        '<plist version="1.0">',
+        '<dict>',
+        '    <key>frames</key>',
+        '    <dict>',
+    ]
+    for name in sorted(frames):
+        x, y, w, h = frames[name]
+        lines += [
+            '        <key>%s</key>' % name,
+            '        <dict>',
+            '            <key>frame</key>',
+            '            <string>{{%d,%d},{%d,%d}}</string>' % (x, y, w, h),
+            '            <key>offset</key>',
+            '            <string>{0,0}</string>',
+            '            <key>rotated</key>',
+            '            <false/>',
+            '            <key>sourceColorRect</key>',
+            '            <string>{{0,0},{%d,%d}}</string>' % (w, h),
+            '            <key>sourceSize</key>',
+            '            <string>{%d,%d}</string>' % (w, h),
+            '        </dict>',
+        ]
+    lines += [
+        '    </dict>',
+        '    <key>metadata</key>',
+        '    <dict>',
+        '        <key>format</key>',
+        '        <integer>2</integer>',
+        '        <key>realTextureFileName</key>',
+        '        <string>%s</string>' % texture_name,
+        '        <key>size</key>',
+        '        <string>{%d,%d}</string>' % (atlas_width, atlas_height),
+        '        <key>textureFileName</key>',
+        '        <string>%s</string>' % texture_name,
+        '    </dict>',
+        '</dict>',
+        '</plist>',
+        '',
+    ]
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    script_dir = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description="Pack card images into a single texture atlas.")
+    parser.add_argument("--resources", default=os.path.join(script_dir, "..", "Resources"))
+    parser.add_argument("--output", default="res/cards", help="atlas path relative to Resources, without extension")
+    parser.add_argument("--max-width", type=int, default=1024)
+    args = parser.parse_args()
+
+    names = collect_sources(args.resources)
+    images = {}
+    for name in names:
+        images[name] = read_png(os.path.join(args.resources, name))
+
+    positions, atlas_width, atlas_height = pack(images, args.max_width)
+    pixels = bytearray(atlas_width * atlas_height * 4)
+    frames = {}
+    for name, (x, y) in positions.items():
+        w, h, rows = images[name]
+        for row in range(h):
+            start = ((y + row) * atlas_width + x) * 4
+            pixels[start:start + w * 4] = rows[row]
+        frames[name] = (x, y, w, h)
+
+    output = os.path.join(args.resources, args.output)
+    texture_name = os.path.basename(args.output) + ".png"
+    write_png(output + ".png", atlas_width, atlas_height, pixels)
+    write_plist(output + ".plist", texture_name, frames, atlas_width, atlas_height)
+    print("packed %d images into %s.png (%dx%d)" % (len(frames), args.output, atlas_width, atlas_height))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())